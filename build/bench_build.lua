@@ -0,0 +1,70 @@
+#!/usr/bin/env lua
+---
+--- Times build.lua's image conversion and compression, on a large generated
+--- tileset and spritesheet, so that we notice if building gets slow again. Run
+--- from the build directory:
+---
+--- lua bench_build.lua [spritesheet width] [spritesheet height]
+---
+
+
+bpcore_build_functions_only = true
+dofile("build.lua")
+
+
+-- Fifteen colors plus the transparent color, the most that a 4bpp image may
+-- use.
+local colors = {{255, 0, 255}}
+for i = 1, 15 do
+   colors[#colors + 1] = {i * 16, 255 - i * 16, (i * 40) % 256}
+end
+
+
+-- Writes a 24bpp bitmap, filled with a pattern that uses every color.
+local function write_test_bitmap(path, w, h)
+   local rows = {}
+   for y = h - 1, 0, -1 do -- bitmap rows are stored bottom-up
+      local row = {}
+      for x = 0, w - 1 do
+         local c = colors[(x // 3 + y // 5 + x * y) % #colors + 1]
+         row[#row + 1] = string.char(c[3], c[2], c[1])
+      end
+      rows[#rows + 1] = table.concat(row)
+   end
+
+   local pixels = table.concat(rows)
+
+   local file = assert(io.open(path, "wb"))
+   file:write(string.pack("<c2I4I4I4", "BM", 54 + #pixels, 0, 54))
+   file:write(string.pack("<I4i4i4I2I2I4I4i4i4I4I4",
+                          40, w, h, 1, 24, 0, #pixels, 2835, 2835, 0, 0))
+   file:write(pixels)
+   file:close()
+end
+
+
+local function time(name, fn, ...)
+   local start = os.clock()
+   local data = fn(...)
+   print(string.format("%s: %.3fs, %d bytes", name, os.clock() - start, #data))
+   return data
+end
+
+
+local sheet_w = tonumber(arg[1]) or 512
+local sheet_h = tonumber(arg[2]) or 512
+
+local path = os.tmpname()
+
+-- The largest tileset that the engine accepts.
+write_test_bitmap(path, 224, 120)
+time("convert_tileset 224x120", convert_tileset, path)
+
+write_test_bitmap(path, sheet_w, sheet_h)
+local sheet = time("convert_spritesheet " .. sheet_w .. "x" .. sheet_h,
+                   convert_spritesheet, path, "32x32")
+
+time("compress_lz77", compress_lz77, sheet)
+time("compress_rle", compress_rle, sheet)
+
+os.remove(path)
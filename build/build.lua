@@ -59,6 +59,13 @@ bitmap =
           return r,g,b
        end
 
+       -- Returns the bytes of row y, three per pixel, in blue, green, red
+       -- order. Much faster than calling get_pixel() for each pixel in the row.
+       function bmp:get_row(y)
+          local index = self.pixel_offset + (self.height - y - 1)*3*self.width
+          return {self.data:byte(index + 1, index + 3*self.width)}
+       end
+
        function bmp:write_to_file(path)
           local file io.open(path, "wb")
           if not file then
@@ -157,12 +164,6 @@ function extension(url)
 end
 
 
-manifest = assert(loadfile("manifest.lua"))
-
-application = manifest();
-app_name = application["name"] .. ".gba"
-
-
 local format_color = function(r, g, b)
    local red = bit32.rshift(r, 3)
    local green = bit32.rshift(g, 3)
@@ -172,36 +173,45 @@ local format_color = function(r, g, b)
 end
 
 
-function write_tile(start_x, start_y, img, map_color)
+-- Decode an image into rows of 15 bit colors, up front, so that converting the
+-- image touches each pixel only once.
+function image_colors(img)
+   local rows = {}
+
+   for y = 0, img.height - 1 do
+      local bytes = img:get_row(y)
+      local row = {}
+      for x = 0, img.width - 1 do
+         local i = x * 3
+         row[x] = format_color(bytes[i + 3], bytes[i + 2], bytes[i + 1])
+      end
+      rows[y] = row
+   end
+
+   return rows
+end
+
+
+function write_tile(out, start_x, start_y, colors, map_color)
    -- GBA hardware expects images to be meta-tiled, so that each 8x8 tile is
    -- effectively flattened, such that the first row of the 8x8 tile is
    -- followed immediately in memory by the next, and the next, for each row
    -- of the 8x8 pixel tile.
-
-   local result = ""
-
+   --
    -- We're going to be outputting 4 bits per pixel, where the bits serve as an
    -- index into a palette table (i.e. we're dealing with 4-bit indexed color).
-   local half = nil
+   -- The tile's bytes go into the out table, and the caller concatenates the
+   -- whole image at once: building the image with .. copies the string so far
+   -- for every byte, which gets very slow for large images.
 
    for y = start_y, start_y + 8 - 1 do
-      for x = start_x, start_x + 8 - 1 do
-         local r, g, b = img:get_pixel(x, y)
-
-         local c15 = format_color(r, g, b)
-
-         local index = map_color(c15)
-         if half then
-            half = bit32.bor(half, bit32.lshift(index, 4))
-            result = result .. string.pack("<I1", half)
-            half = nil
-         else
-            half = index
-         end
+      local row = colors[y]
+      for x = start_x, start_x + 8 - 1, 2 do
+         local lo = map_color(row[x])
+         local hi = map_color(row[x + 1])
+         out[#out + 1] = string.char(bit32.bor(lo, bit32.lshift(hi, 4)))
       end
    end
-
-   return result
 end
 
 
@@ -225,7 +235,7 @@ end
 
 function write_palette(palette, source)
    local palette_out = {}
-   local result = ""
+   local result = {}
 
    local id_max = 0
 
@@ -241,16 +251,163 @@ function write_palette(palette, source)
    end
 
    for i = 0, id_max do
-      result = result .. string.pack("<I2", palette_out[i])
+      result[#result + 1] = string.pack("<I2", palette_out[i])
    end
 
    if id_max ~= 15 then
       for i = id_max + 1, 15 do
-         result = result .. string.pack("<I2", 0)
+         result[#result + 1] = string.pack("<I2", 0)
+      end
+   end
+
+   return table.concat(result)
+end
+
+
+-- Screen entry flags, for flipped tiles.
+tile_hflip = 0x400
+tile_vflip = 0x800
+
+
+local swapped_nibbles = {}
+for i = 0, 255 do
+   swapped_nibbles[i] = bit32.bor(bit32.rshift(i, 4),
+                                  bit32.lshift(bit32.band(i, 15), 4))
+end
+
+
+-- Mirror a tile, in the format written by write_tile(): four bytes per row,
+-- two pixels per byte, with the left pixel in the low nibble.
+function flip_tile(tile, hflip, vflip)
+   local rows = {}
+
+   for y = 0, 7 do
+      local a, b, c, d = tile:byte(y * 4 + 1, y * 4 + 4)
+      local row
+      if hflip then
+         row = string.char(swapped_nibbles[d],
+                           swapped_nibbles[c],
+                           swapped_nibbles[b],
+                           swapped_nibbles[a])
+      else
+         row = string.char(a, b, c, d)
+      end
+
+      if vflip then
+         rows[8 - y] = row
+      else
+         rows[y + 1] = row
       end
    end
 
-   return result
+   return table.concat(rows)
+end
+
+
+-- The most palettes that the engine supports for a tileset.
+max_tileset_palettes = 4
+
+
+-- Split an image's tiles between up to count palettes, of fifteen colors each,
+-- plus the transparent color. Returns the palette number (from zero) of each
+-- tile, in the same order that convert_tileset() visits the tiles, along with
+-- the number of palettes used.
+--
+-- Finding the fewest palettes is hard, so we place tiles greedily: tiles with
+-- the most colors go first, each into the palette that it adds the fewest new
+-- colors to. A tile that shares no colors with the palettes so far starts a
+-- new palette, if we have any left.
+function assign_palettes(path, colors, w, h, count)
+   local result = {}
+
+   if count == 1 then
+      for i = 1, (w // 8) * (h // 8) do
+         result[i] = 0
+      end
+      return result, 1
+   end
+
+   local transparent = format_color(255, 0, 255)
+   local tiles = {}
+
+   for block_y = 0, h - 1, 8 do
+      for block_x = 0, w - 1, 8 do
+         local set = {}
+         local n = 0
+         for y = block_y, block_y + 7 do
+            local row = colors[y]
+            for x = block_x, block_x + 7 do
+               local c = row[x]
+               if c ~= transparent and not set[c] then
+                  set[c] = true
+                  n = n + 1
+               end
+            end
+         end
+
+         if n > 15 then
+            error("tile at " .. block_x .. ", " .. block_y .. " of " .. path ..
+                     " has too many colors! (Expected: 15 + transparent)")
+         end
+
+         tiles[#tiles + 1] = {set = set, count = n, index = #tiles + 1}
+      end
+   end
+
+   local order = {}
+   for i, tile in ipairs(tiles) do
+      order[i] = tile
+   end
+
+   table.sort(order, function(a, b)
+      if a.count ~= b.count then
+         return a.count > b.count
+      end
+      return a.index < b.index
+   end)
+
+   local palettes = {}
+
+   for _, tile in ipairs(order) do
+      local best = nil
+      local best_cost = nil
+
+      for p, palette in ipairs(palettes) do
+         local cost = 0
+         for c in pairs(tile.set) do
+            if not palette.set[c] then
+               cost = cost + 1
+            end
+         end
+
+         if palette.count + cost <= 15 and
+            (best == nil or cost < best_cost) then
+            best = p
+            best_cost = cost
+         end
+      end
+
+      if (best == nil or (best_cost == tile.count and tile.count > 0)) and
+         #palettes < count then
+         palettes[#palettes + 1] = {set = {}, count = 0}
+         best = #palettes
+      elseif best == nil then
+         error("image " .. path .. " needs more than " .. count ..
+                  " palettes!")
+      end
+
+      local palette = palettes[best]
+      for c in pairs(tile.set) do
+         if not palette.set[c] then
+            palette.set[c] = true
+            palette.count = palette.count + 1
+         end
+      end
+
+      result[tile.index] = best - 1
+   end
+
+   return result, math.max(#palettes, 1)
 end
 
 
@@ -258,7 +415,18 @@ end
 -- out how to parse bmp files on a gameboy, that's easy. But needing to process
 -- data before loading it into VRAM would significantly slow down texture
 -- loading.
-function convert_tileset(path)
+--
+-- With dedup, we only keep the first copy of each tile, and also drop tiles
+-- that mirror an earlier tile, because the hardware can flip tiles for free.
+-- The third result is then a remap table, a little-endian u16 for each tile
+-- of the original image, holding the tile's index in the deduplicated tileset,
+-- with the tile_hflip and tile_vflip bits set for mirrored tiles.
+--
+-- With palette_count greater than one, the tiles may use up to palette_count
+-- different palettes (see assign_palettes()). If the image needs more than
+-- one, the palette file holds the palettes back to back, followed by a byte
+-- for each tile of the tileset, with the tile's palette number.
+function convert_tileset(path, dedup, palette_count)
    local img, err = bitmap.from_file(path)
 
    if img == nil then
@@ -272,39 +440,141 @@ function convert_tileset(path)
       error("image width and height must be multiples of 8")
    end
 
-   local palette = {}
+   palette_count = palette_count or 1
+   if palette_count < 1 or palette_count > max_tileset_palettes then
+      error("tileset " .. path .. " may use 1 to " .. max_tileset_palettes ..
+               " palettes")
+   end
 
-   map_color = make_color_mapper(palette)
+   if not dedup and (w * h) > 26880 then
+      error("image " .. path .. " too large!")
+   end
 
-   -- Transparent color constant should have index 0
-   map_color(format_color(255, 0, 255))
+   local colors = image_colors(img)
 
-   if (w * h) > 26880 then
-      error("image " .. path .. " too large!")
+   local tile_palettes, used = assign_palettes(path, colors, w, h,
+                                               palette_count)
+
+   local palettes = {}
+   local mappers = {}
+   for p = 1, used do
+      palettes[p] = {}
+      mappers[p] = make_color_mapper(palettes[p])
+
+      -- Transparent color constant should have index 0
+      mappers[p](format_color(255, 0, 255))
    end
 
-   local img_data = ""
+   local img_data = {}
+   local banks = {} -- palette number of each tile in the tileset
+   local unique = {} -- palette and tile data -> index in the tileset
+   local remap = {}
+   local tile_index = 0
 
    for block_y = 0, h - 1, 8 do
       for block_x = 0, w - 1, 8 do
-         img_data = img_data .. write_tile(block_x, block_y, img, map_color)
+         tile_index = tile_index + 1
+         local p = tile_palettes[tile_index]
+         local map_color = mappers[p + 1]
+
+         if not dedup then
+            write_tile(img_data, block_x, block_y, colors, map_color)
+            banks[#banks + 1] = string.char(p)
+         else
+            local tile = {}
+            write_tile(tile, block_x, block_y, colors, map_color)
+            tile = table.concat(tile)
+
+            -- Tiles with the same pixels only match if they also use the
+            -- same palette.
+            local bank = string.char(p)
+            local entry = unique[bank .. tile]
+            if entry == nil then
+               local hflip = unique[bank .. flip_tile(tile, true, false)]
+               local vflip = unique[bank .. flip_tile(tile, false, true)]
+               local hvflip = unique[bank .. flip_tile(tile, true, true)]
+
+               if hflip then
+                  entry = hflip + tile_hflip
+               elseif vflip then
+                  entry = vflip + tile_vflip
+               elseif hvflip then
+                  entry = hvflip + tile_hflip + tile_vflip
+               else
+                  entry = #img_data
+                  unique[bank .. tile] = entry
+                  img_data[#img_data + 1] = tile
+                  banks[#banks + 1] = bank
+               end
+            end
+
+            remap[#remap + 1] = string.pack("<I2", entry)
+         end
       end
    end
 
-   return img_data, write_palette(palette, path)
+   if dedup and #img_data * 64 > 26880 then
+      error("image " .. path .. " too large! (" .. #img_data ..
+               " unique tiles)")
+   end
+
+   local palette_data = {}
+   for p = 1, used do
+      palette_data[p] = write_palette(palettes[p], path)
+   end
+   if used > 1 then
+      palette_data[#palette_data + 1] = table.concat(banks)
+   end
+
+   if dedup then
+      return table.concat(img_data),
+         table.concat(palette_data),
+         table.concat(remap)
+   end
+
+   return table.concat(img_data), table.concat(palette_data)
 end
 
 
--- The engine uses 8x8 pixel tiles, and 16x16 pixel sprites, so sprite data
--- needs to be processed differently (meta-tiled 2x2)
-function convert_spritesheet(path)
+-- Sprite sizes supported by the gba hardware. The engine identifies sizes by
+-- number, see Sprite::Size.
+sprite_sizes = {
+   ["16x16"] = 0,
+   ["8x8"] = 1,
+   ["32x32"] = 2,
+   ["64x64"] = 3,
+   ["16x8"] = 4,
+   ["32x8"] = 5,
+   ["32x16"] = 6,
+   ["64x32"] = 7,
+   ["8x16"] = 8,
+   ["8x32"] = 9,
+   ["16x32"] = 10,
+   ["32x64"] = 11,
+}
+
+
+-- The engine uses 8x8 pixel tiles, and sprites of various sizes (16x16 by
+-- default), so sprite data needs to be processed differently: each sprite
+-- frame is meta-tiled, so that a frame's 8x8 tiles are contiguous in memory.
+function convert_spritesheet(path, size)
+   size = size or "16x16"
+
+   if sprite_sizes[size] == nil then
+      error("spritesheet " .. path .. " has unsupported sprite size " .. size)
+   end
+
+   local fw, fh = size:match("^(%d+)x(%d+)$")
+   fw = tonumber(fw)
+   fh = tonumber(fh)
+
    local img = bitmap.from_file(path)
    local w = img.width
    local h = img.height
 
-   if h % 16 ~= 0 or w % 16 ~= 0 then
-      -- TODO: support rectangular sizes
-      error("spritesheet dimensions must be a multiple of 16")
+   if h % fh ~= 0 or w % fw ~= 0 then
+      error("spritesheet " .. path .. " dimensions must be a multiple of " ..
+               size)
    end
 
    local palette = {}
@@ -314,65 +584,316 @@ function convert_spritesheet(path)
    -- Transparent color constant should have index 0
    map_color(format_color(255, 0, 255))
 
-   local img_data = ""
+   local colors = image_colors(img)
+   local img_data = {}
 
-   for meta_y = 0, h - 1, 16 do
-      for meta_x = 0, w - 1, 16 do
-         for block_y = meta_y, meta_y + 16 - 1, 8 do
-            for block_x = meta_x, meta_x + 16 - 1, 8 do
-               local tile_data = write_tile(block_x, block_y, img, map_color)
-               img_data = img_data .. tile_data
+   for meta_y = 0, h - 1, fh do
+      for meta_x = 0, w - 1, fw do
+         for block_y = meta_y, meta_y + fh - 1, 8 do
+            for block_x = meta_x, meta_x + fw - 1, 8 do
+               write_tile(img_data, block_x, block_y, colors, map_color)
             end
          end
       end
    end
 
-   return img_data, write_palette(palette, path)
+   return table.concat(img_data), write_palette(palette, path)
 end
 
 
--- Create the application bundle, by copying the engine ROM
-cp("BPCoreEngine.gba", app_name)
+-- Compressors for the lz77 and run-length formats of the gba bios, which the
+-- engine uses to decompress files straight into vram. See
+-- gba_platform_compression.hpp for a description of the formats. The output
+-- is exactly what the bios reads, bundle_file() records the format in the
+-- file's header.
+function compress_lz77(data)
+   local n = #data
+   local out = {
+      string.pack("<I4", bit32.bor(0x10, bit32.lshift(n, 8)))
+   }
+
+   local b = {}
+   for i = 1, n, 4096 do
+      local bytes = {data:byte(i, i + 4095)}
+      for j = 1, #bytes do
+         b[i + j - 1] = bytes[j]
+      end
+   end
 
+   -- Hash chains of earlier positions, keyed by the three bytes at each
+   -- position, so that we only compare against likely matches.
+   local heads = {}
+   local prev = {}
 
-bundle = io.open(app_name, "ab")
+   local function insert(p)
+      if p + 2 <= n then
+         local key = b[p] * 65536 + b[p + 1] * 256 + b[p + 2]
+         prev[p] = heads[key]
+         heads[key] = p
+      end
+   end
 
+   local pos = 1
+   while pos <= n do
+      local flags = 0
+      local block = {}
 
--- The engine uses this key to find the resource bundle within the rom.
+      for bit = 7, 0, -1 do
+         if pos > n then
+            break
+         end
 
--- NOTE: The engine _used to_ use this string to find the resource bundle within
--- the ROM. Now, we use an address provided by the linker. We write the
--- filesystem id for backwards compatibility purposes (if someone uses build.lua
--- with an old engine ROM), as well as to detect within the engine whether
--- someone forgot to attach the resource bundle.
-bundle:write("core_filesys")
+         local best_len = 0
+         local best_dist = 0
+
+         if pos + 2 <= n then
+            local max_len = math.min(18, n - pos + 1)
+            local candidate = heads[b[pos] * 65536 + b[pos + 1] * 256 +
+                                       b[pos + 2]]
+            local tries = 0
+
+            while candidate and pos - candidate <= 4096 and tries < 32 do
+               local dist = pos - candidate
+
+               -- The vram decompressor writes two bytes at a time, so it
+               -- can't copy the byte right before the current one.
+               if dist >= 2 then
+                  local len = 0
+                  while len < max_len and
+                     b[candidate + len] == b[pos + len] do
+                     len = len + 1
+                  end
+                  if len > best_len then
+                     best_len = len
+                     best_dist = dist
+                     if len == max_len then
+                        break
+                     end
+                  end
+               end
+
+               candidate = prev[candidate]
+               tries = tries + 1
+            end
+         end
 
+         if best_len >= 3 then
+            flags = bit32.bor(flags, bit32.lshift(1, bit))
+            block[#block + 1] =
+               string.char(bit32.bor(bit32.lshift(best_len - 3, 4),
+                                     bit32.rshift(best_dist - 1, 8)),
+                           bit32.band(best_dist - 1, 0xff))
+            for p = pos, pos + best_len - 1 do
+               insert(p)
+            end
+            pos = pos + best_len
+         else
+            block[#block + 1] = string.char(b[pos])
+            insert(pos)
+            pos = pos + 1
+         end
+      end
 
-function bundle_resource(fname, data)
-   -- Bundle Resource Header:
-   --
-   -- char name[32] - filename
-   -- char size[16] - string representation of the file size
-   -- contents[...]
-   -- null byte     - null terminator
-   -- padding (word alignment) - we can load stuff faster from aligned addresses
+      out[#out + 1] = string.char(flags)
+      out[#out + 1] = table.concat(block)
+   end
+
+   return table.concat(out)
+end
+
+
+function compress_rle(data)
+   local n = #data
+   local out = {
+      string.pack("<I4", bit32.bor(0x30, bit32.lshift(n, 8)))
+   }
+
+   local literals = {}
+
+   local function flush()
+      for i = 1, #literals, 128 do
+         local count = math.min(128, #literals - i + 1)
+         out[#out + 1] = string.char(count - 1)
+         out[#out + 1] = table.concat(literals, "", i, i + count - 1)
+      end
+      literals = {}
+   end
+
+   local i = 1
+   while i <= n do
+      local byte = data:byte(i)
+      local run = 1
+      while i + run <= n and run < 130 and data:byte(i + run) == byte do
+         run = run + 1
+      end
+
+      if run >= 3 then
+         flush()
+         out[#out + 1] = string.char(0x80 + run - 3, byte)
+         i = i + run
+      else
+         literals[#literals + 1] = string.char(byte)
+         i = i + 1
+      end
+   end
+
+   flush()
+
+   return table.concat(out)
+end
+
+
+-- The bios's compression types, which the engine reads from a compressed
+-- file's bundle header.
+compression_types = { lz77 = 0x10, rle = 0x30 }
+
+
+-- Compress data with the method named by a manifest entry's compress option,
+-- if any.
+function compress(data, method)
+   if method == nil then
+      return data
+   elseif method == "lz77" then
+      return compress_lz77(data)
+   elseif method == "rle" then
+      return compress_rle(data)
+   end
+
+   error("unsupported compression " .. method .. " (expected lz77 or rle)")
+end
+
+
+-- IMA-ADPCM encoder. Stores each 8-bit sample as a four bit delta, halving the
+-- size of the audio data. The engine decodes adpcm music as it plays, see
+-- gba_platform_adpcm.hpp for the decoder and a description of the format.
+adpcm_block_samples = 512
+
+adpcm_step_table = {
+   7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+   50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+   253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+   1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+   3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+   11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+   32767
+}
 
+adpcm_index_table = {
+   -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8
+}
+
+
+function encode_adpcm(pcm)
+   local sample_count = string.len(pcm)
+   local result = {
+      string.pack("<c4I4I2I2", "IMA4", sample_count, adpcm_block_samples, 0)
+   }
+
+   local predictor = 0
+   local index = 0
+
+   local function sample(i)
+      local b = pcm:byte(i)
+      if b >= 128 then
+         b = b - 256
+      end
+      return b * 256
+   end
+
+   -- Picks the nibble that gets the decoder's predictor closest to the target,
+   -- then updates our copy of the decoder state exactly as the engine would,
+   -- so that the encoder and decoder never drift apart.
+   local function encode(target)
+      local step = adpcm_step_table[index + 1]
+      local diff = target - predictor
+      local nibble = 0
+
+      if diff < 0 then
+         nibble = 8
+         diff = -diff
+      end
+      if diff >= step then
+         nibble = nibble + 4
+         diff = diff - step
+      end
+      if diff >= step // 2 then
+         nibble = nibble + 2
+         diff = diff - step // 2
+      end
+      if diff >= step // 4 then
+         nibble = nibble + 1
+      end
+
+      local delta = step // 8
+      if bit32.band(nibble, 1) ~= 0 then delta = delta + step // 4 end
+      if bit32.band(nibble, 2) ~= 0 then delta = delta + step // 2 end
+      if bit32.band(nibble, 4) ~= 0 then delta = delta + step end
+
+      if bit32.band(nibble, 8) ~= 0 then
+         predictor = math.max(predictor - delta, -32768)
+      else
+         predictor = math.min(predictor + delta, 32767)
+      end
+
+      index = math.min(math.max(index + adpcm_index_table[nibble + 1], 0), 88)
+
+      return nibble
+   end
+
+   for start = 1, sample_count, adpcm_block_samples do
+      -- Each block starts over from its first sample, so that the engine can
+      -- begin decoding at any block.
+      predictor = sample(start)
+      table.insert(result, string.pack("<i2I1I1", predictor, index, 0))
+
+      local bytes = {}
+      for i = start, start + adpcm_block_samples - 1, 2 do
+         local lo, hi = 0, 0
+         if i <= sample_count then
+            lo = encode(sample(i))
+         end
+         if i + 1 <= sample_count then
+            hi = encode(sample(i + 1))
+         end
+         table.insert(bytes, string.char(lo + hi * 16))
+      end
+
+      table.insert(result, table.concat(bytes))
+   end
+
+   return table.concat(result)
+end
+
+
+-- Bundle Resource Header:
+--
+-- char name[32]  - filename
+-- char size[15]  - string representation of the file size
+-- u8 compression - compression_types[method], or zero if uncompressed
+-- contents[...]
+-- null byte      - null terminator
+-- padding (word alignment) - we can load stuff faster from aligned addresses
+--
+-- The functions below write to the global bundle file.
+function bundle_resource_header(fname, datalen, compression)
    bundle:write(fname)
 
    for i = 0, 31 - string.len(fname) do
       bundle:write("\0")
    end
 
-   local datalen = string.len(data)
    local lenstr = tostring(datalen)
    bundle:write(lenstr)
 
-   for i = 0, 15 - string.len(lenstr) do
+   for i = 0, 14 - string.len(lenstr) do
       bundle:write("\0")
    end
 
-   bundle:write(data)
+   bundle:write(string.char(compression or 0))
+end
 
+
+function bundle_resource_footer(datalen)
    -- BPCore requires data to be null-terminated
    bundle:write("\0")
 
@@ -381,44 +902,399 @@ function bundle_resource(fname, data)
    for i = 0, ((datalen + 1) % 4) - 1 do
       bundle:write("\0")
    end
+end
+
+
+-- The bios wants compressed data to be word-aligned, but the bundle does not
+-- align files to words. So we pad the start of compressed files up to the next
+-- word boundary. The engine finds the compressed data the same way. ROM
+-- addresses start at a word boundary, so offsets in the rom file tell us the
+-- alignment.
+function bundle_compressed_file(fname, path, method)
+   local data = contents(path)
+
+   local start = bundle:seek() + 48 -- header size
+   data = string.rep("\0", (4 - start % 4) % 4) .. data
 
+   bundle_resource_header(fname, #data, compression_types[method])
+   bundle:write(data)
+   bundle_resource_footer(#data)
 end
 
 
-for _, fname in pairs(application["tilesets"]) do
+-- Copy a file into the bundle a chunk at a time, rather than reading the whole
+-- thing into memory. Pass the compression method, if the file at path holds
+-- the output of compress().
+function bundle_file(fname, path, method)
+   if method then
+      return bundle_compressed_file(fname, path, method)
+   end
+
+   local file = assert(io.open(path, "rb"))
+   local datalen = file:seek("end")
+   file:seek("set", 0)
+
+   bundle_resource_header(fname, datalen)
+
+   while true do
+      local chunk = file:read(65536)
+      if not chunk then
+         break
+      end
+      bundle:write(chunk)
+   end
+
+   file:close()
+
+   bundle_resource_footer(datalen)
+end
+
+
+-- Scripts that only want the conversion functions above, like
+-- bench_build.lua, set this flag before loading the build script.
+if bpcore_build_functions_only then
+   return
+end
+
+
+manifest = assert(loadfile("manifest.lua"))
+
+application = manifest();
+app_name = application["name"] .. ".gba"
+
+
+-- Create the application bundle, by copying the engine ROM
+cp("BPCoreEngine.gba", app_name)
+
+
+bundle = io.open(app_name, "ab")
+
+
+-- The engine uses this key to find the resource bundle within the rom.
+
+-- NOTE: The engine _used to_ use this string to find the resource bundle within
+-- the ROM. Now, we use an address provided by the linker. We write the
+-- filesystem id for backwards compatibility purposes (if someone uses build.lua
+-- with an old engine ROM), as well as to detect within the engine whether
+-- someone forgot to attach the resource bundle.
+bundle:write("core_filesys")
+
+
+-- Converted assets go into the cache directory, named after a hash of the
+-- source file's contents, so that we only need to convert the files that
+-- changed since the last build. Bump cache_version whenever a converter's
+-- output changes, so that we don't pick up stale conversions.
+cache_dir = "build_cache"
+cache_version = 2
+
+
+-- 32 bit FNV-1a, followed by the length of the data, which makes collisions
+-- between files of different sizes impossible.
+function content_hash(data)
+   local h = 0x811c9dc5
+
+   for i = 1, #data, 4096 do
+      local bytes = {data:byte(i, i + 4095)}
+      for j = 1, #bytes do
+         h = bit32.band(bit32.bxor(h, bytes[j]) * 0x01000193, 0xffffffff)
+      end
+   end
+
+   return string.format("%08x-%d", h, #data)
+end
+
+
+function file_exists(path)
+   local file = io.open(path, "rb")
+   if file then
+      file:close()
+      return true
+   end
+   return false
+end
+
+
+function write_cache_file(path, data)
+   local file = io.open(path .. ".tmp", "wb")
+   if not file then
+      os.execute(string.format('mkdir "%s"', cache_dir))
+      file = assert(io.open(path .. ".tmp", "wb"))
+   end
+
+   file:write(data)
+   file:close()
+
+   -- Rename the finished file into place, so that an interrupted build never
+   -- leaves a partial file in the cache.
+   os.remove(path)
+   assert(os.rename(path .. ".tmp", path))
+end
+
+
+-- Returns the paths of the cached results of convert(), which returns count
+-- strings. Calls convert() only if the cache does not already have results
+-- for the current contents of fname. The option string (e.g. a sprite size)
+-- becomes part of the cache key, for converters that accept options.
+function convert_cached(kind, fname, option, count, convert)
+   local key = string.format("%s/%s-%s-%d-%s",
+                             cache_dir,
+                             kind,
+                             option or "",
+                             cache_version,
+                             content_hash(contents(fname)))
+
+   local paths = {}
+   local hit = true
+   for i = 1, count do
+      paths[i] = key .. "." .. i
+      if not file_exists(paths[i]) then
+         hit = false
+      end
+   end
+
+   if hit then
+      print(string.format("%-12s %-32s cached", kind, fname))
+      return paths
+   end
+
+   local start = os.clock()
+   local results = {convert()}
+
+   for i = 1, count do
+      write_cache_file(paths[i], results[i])
+   end
+
+   print(string.format("%-12s %-32s converted in %.3fs",
+                       kind,
+                       fname,
+                       os.clock() - start))
+
+   return paths
+end
+
+
+-- Remap table paths for deduplicated tilesets, for converting the maps that
+-- use them.
+tileset_remaps = {}
+
+
+-- Tileset entries are either a filename, or a table with a filename and
+-- options, e.g. { "level.bmp", dedup = true, palettes = 4, compress = "lz77" }.
+for _, entry in pairs(application["tilesets"]) do
+   local fname = entry
+   local dedup = false
+   local palettes = nil
+   local method = nil
+   if type(entry) == "table" then
+      fname = entry[1]
+      dedup = entry.dedup
+      palettes = entry.palettes
+      method = entry.compress
+   end
+
    if extension(fname) ~= ".bmp" then
       error("tilesets should be in a .bmp format!")
    end
 
-   local data, palette = convert_tileset(fname)
-   bundle_resource(fname, data)
-   bundle_resource(fname .. ".pal", palette)
+   local options = {}
+   if dedup then
+      table.insert(options, "dedup")
+   end
+   if palettes then
+      table.insert(options, "pal" .. palettes)
+   end
+   if method then
+      table.insert(options, method)
+   end
+   local option = nil
+   if #options > 0 then
+      option = table.concat(options, "_")
+   end
+
+   local count = 2
+   if dedup then
+      count = 3
+   end
+
+   local paths = convert_cached("tileset", fname, option, count, function()
+      local results = {convert_tileset(fname, dedup, palettes)}
+      results[1] = compress(results[1], method)
+      return table.unpack(results)
+   end)
+   bundle_file(fname, paths[1], method)
+   bundle_file(fname .. ".pal", paths[2])
+
+   if dedup then
+      bundle_file(fname .. ".remap", paths[3])
+      tileset_remaps[fname] = paths[3]
+   end
 end
 
 
-for _, fname in pairs(application["spritesheets"]) do
+-- Spritesheet entries are either a filename, or a table with a filename and
+-- options, e.g. { "boss.bmp", size = "64x64", compress = "lz77" }.
+for _, entry in pairs(application["spritesheets"]) do
+   local fname = entry
+   local size = nil
+   local method = nil
+   if type(entry) == "table" then
+      fname = entry[1]
+      size = entry.size
+      method = entry.compress
+   end
+
    if extension(fname) ~= ".bmp" then
       error("spritesheets should be in a .bmp format!")
    end
 
-   local data, palette = convert_spritesheet(fname)
-   bundle_resource(fname, data)
-   bundle_resource(fname .. ".pal", palette)
+   local option = size
+   if method then
+      option = (size or "") .. "_" .. method
+   end
+
+   local paths = convert_cached("spritesheet", fname, option, 2, function()
+      local data, palette = convert_spritesheet(fname, size)
+      return compress(data, method), palette
+   end)
+   bundle_file(fname, paths[1], method)
+   bundle_file(fname .. ".pal", paths[2])
+end
+
+
+-- Convert a csv tilemap into the binary format used by the engine's mapstream()
+-- function: a little-endian u16 width and height, followed by a u16 for each
+-- tile, row by row. Parsing csv files on the gba is slow, and we need random
+-- access to the map data when streaming.
+--
+-- For maps drawn with a deduplicated tileset, remap holds the tileset's remap
+-- table, and we translate each tile index through it. Flip bits in the csv
+-- combine with the flip bits from the remap table.
+function convert_tilemap(path, remap)
+   local rows = {}
+   local width = nil
+
+   for line in io.lines(path) do
+      line = line:gsub("\r", "")
+      if line ~= "" then
+         local row = {}
+         for cell in line:gmatch("[^,]+") do
+            table.insert(row, tonumber(cell))
+         end
+         if width == nil then
+            width = #row
+         elseif width ~= #row then
+            error("tilemap " .. path .. " has rows of different lengths")
+         end
+         table.insert(rows, row)
+      end
+   end
+
+   if width == nil then
+      error("tilemap " .. path .. " is empty")
+   end
+
+   local result = {string.pack("<I2I2", width, #rows)}
+   for _, row in ipairs(rows) do
+      for _, t in ipairs(row) do
+         if remap then
+            local index = bit32.band(t, 0x3ff)
+            if index * 2 >= #remap then
+               error("tilemap " .. path .. " uses tile " .. index ..
+                        ", which is not in its tileset")
+            end
+            local entry = string.unpack("<I2", remap, index * 2 + 1)
+            t = bit32.bxor(entry, bit32.band(t, 0xfc00))
+         end
+         table.insert(result, string.pack("<I2", t))
+      end
+   end
+
+   return table.concat(result)
 end
 
 
-for _, fname in pairs(application["scripts"]) do
-   bundle_resource(fname, contents(fname))
+-- Map entries are either a filename, or a table with a filename and options:
+-- the deduplicated tileset that the map uses, and the compression, e.g.
+-- { "level1.csv", tileset = "level.bmp", compress = "rle" }.
+if application["maps"] then
+   for _, entry in pairs(application["maps"]) do
+      local fname = entry
+      local tileset = nil
+      local method = nil
+      if type(entry) == "table" then
+         fname = entry[1]
+         tileset = entry.tileset
+         method = entry.compress
+      end
+
+      if extension(fname) ~= ".csv" then
+         error("maps should be in a .csv format!")
+      end
+
+      local remap = nil
+      local option = nil
+      if tileset then
+         if tileset_remaps[tileset] == nil then
+            error("map " .. fname .. " uses " .. tileset ..
+                     ", which is not a deduplicated tileset")
+         end
+         remap = contents(tileset_remaps[tileset])
+         option = content_hash(remap)
+      end
+      if method then
+         option = (option or "") .. "_" .. method
+      end
+
+      local name = fname:gsub("%.csv$", ".map")
+      local paths = convert_cached("map", fname, option, 1, function()
+         return compress(convert_tilemap(fname, remap), method)
+      end)
+      bundle_file(name, paths[1], method)
+   end
 end
 
 
-for _, fname in pairs(application["audio"]) do
-   bundle_resource(fname, contents(fname))
+-- Script entries are either a filename, or a table with a filename and a
+-- compression, e.g. { "main.lua", compress = "lz77" }.
+for _, entry in pairs(application["scripts"]) do
+   if type(entry) == "table" then
+      local fname = entry[1]
+      local method = entry.compress
+      local paths = convert_cached("script", fname, method, 1, function()
+         return compress(contents(fname), method)
+      end)
+      bundle_file(fname, paths[1], method)
+   else
+      bundle_file(entry, entry)
+   end
+end
+
+
+-- Audio entries are either a filename, or a table with a filename and a
+-- format, e.g. { "music.raw", format = "adpcm" }. Only music supports adpcm.
+for _, entry in pairs(application["audio"]) do
+   local fname = entry
+   local format = nil
+   if type(entry) == "table" then
+      fname = entry[1]
+      format = entry.format
+   end
+
+   if format == "adpcm" then
+      local paths = convert_cached("audio", fname, format, 1, function()
+         return encode_adpcm(contents(fname))
+      end)
+      bundle_file(fname, paths[1])
+   elseif format ~= nil then
+      error("audio file " .. fname .. " has unsupported format " .. format)
+   else
+      bundle_file(fname, fname)
+   end
 end
 
 
 for _, fname in pairs(application["misc"]) do
-   bundle_resource(fname, contents(fname))
+   bundle_file(fname, fname)
 end
 
 
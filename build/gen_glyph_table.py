@@ -0,0 +1,86 @@
+# Generates the engine's codepoint to glyph lookup table, from the charset
+# mapping file. We used to compile the mappings into a couple of giant switch
+# statements, but gcc does not reliably turn sparse switches into lookup
+# tables when targeting thumb code, so text rendering ended up running through
+# thousands of compare-and-branch instructions. Instead, we generate a direct
+# table for ascii, and a sorted table of everything else, which the engine
+# binary searches (see localization.cpp).
+#
+# usage: python3 gen_glyph_table.py charset_mapping.txt glyph_table.cpp
+
+import sys
+
+
+def parse_glyph(text):
+    if text.startswith('U+'):
+        return chr(int(text[2:], 16))
+    if len(text) != 1:
+        raise ValueError('expected a single glyph, got "' + text + '"')
+    return text
+
+
+def packed_codepoint(glyph):
+    """
+    The engine does not decode utf-8 into real unicode codepoints, instead, it
+    packs the raw utf-8 bytes into a little-endian 32-bit integer. For ascii,
+    the values are the same.
+    """
+    return int.from_bytes(glyph.encode('utf-8'), 'little')
+
+
+def read_mappings(file_name):
+    mappings = {}
+
+    with open(file_name, encoding='utf-8') as f:
+        for line_num, line in enumerate(f, 1):
+            line = line.rstrip('\n')
+            if not line or line.startswith('#'):
+                continue
+
+            glyph, index = line.rsplit(' ', 1)
+            key = packed_codepoint(parse_glyph(glyph))
+
+            # The first mapping for a glyph wins.
+            if key not in mappings:
+                mappings[key] = int(index)
+
+    return mappings
+
+
+def format_array(values, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def write_table(mappings, file_name):
+    ascii = [str(mappings.get(cp, 0)) for cp in range(128)]
+
+    unicode = sorted((k, v) for k, v in mappings.items() if k >= 128)
+    keys = ['0x%08x' % k for k, _ in unicode]
+    values = [str(v) for _, v in unicode]
+
+    with open(file_name, 'w') as out:
+        out.write('// Generated by build/gen_glyph_table.py, from ' +
+                  'build/charset_mapping.txt.\n')
+        out.write('// Do not edit by hand.\n\n')
+        out.write('#include "number/int.h"\n\n\n')
+
+        out.write('// Indexed by ascii value, zero for characters without '
+                  'a glyph.\n')
+        out.write('extern const u16 glyph_table_ascii[128] = {\n')
+        out.write(format_array(ascii, 12) + '\n};\n\n\n')
+
+        out.write('// Packed utf-8 codepoints, sorted.\n')
+        out.write('extern const u32 glyph_table_keys[%d] = {\n' % len(keys))
+        out.write(format_array(keys, 6) + '\n};\n\n\n')
+
+        out.write('extern const u16 glyph_table_values[%d] = {\n' % len(keys))
+        out.write(format_array(values, 12) + '\n};\n\n\n')
+
+        out.write('extern const u32 glyph_table_size = %d;\n' % len(keys))
+
+
+if __name__ == "__main__":
+    write_table(read_mappings(sys.argv[1]), sys.argv[2])
@@ -709,3 +709,51 @@ void *umm_calloc( size_t num, size_t item_size ) {
 }
 
 /* ------------------------------------------------------------------------ */
+
+/* ------------------------------------------------------------------------ */
+
+/*
+ * A cheaper alternative to umm_info(), for callers that only want to know
+ * about free memory. Walks the free list, rather than every block in the
+ * heap, so it costs about as much as a call to umm_malloc(), which walks the
+ * same list to find the best fit. Does not need UMM_INFO.
+ */
+
+void umm_free_stats( UMM_FREE_STATS *stats ) {
+  uint16_t cf;
+
+  if (umm_heap == NULL) {
+    umm_init();
+  }
+
+  memset( stats, 0, sizeof( *stats ) );
+
+  stats->heapBytes = UMM_NUMBLOCKS * sizeof(umm_block);
+
+  /* Protect the critical section... */
+  UMM_CRITICAL_ENTRY();
+
+  cf = UMM_NFREE(0);
+
+  while( cf ) {
+    uint32_t blocks = (UMM_NBLOCK(cf) & UMM_BLOCKNO_MASK) - cf;
+
+    ++stats->freeEntries;
+    stats->freeBlocks += blocks;
+    stats->freeBlocksSquared += blocks * blocks;
+
+    if( blocks > stats->maxFreeBlocks ) {
+      stats->maxFreeBlocks = blocks;
+    }
+
+    cf = UMM_NFREE(cf);
+  }
+
+  /* Release the critical section... */
+  UMM_CRITICAL_EXIT();
+
+  stats->freeBytes = stats->freeBlocks * sizeof(umm_block);
+  stats->maxFreeBytes = stats->maxFreeBlocks * sizeof(umm_block);
+}
+
+/* ------------------------------------------------------------------------ */
@@ -24,6 +24,22 @@ extern void  umm_free( void *ptr );
 
 /* ------------------------------------------------------------------------ */
 
+typedef struct UMM_FREE_STATS_t {
+  uint32_t heapBytes;
+  uint32_t freeBytes;
+  uint32_t maxFreeBytes;
+  uint32_t freeEntries;
+
+  uint32_t freeBlocks;
+  uint32_t freeBlocksSquared;
+  uint32_t maxFreeBlocks;
+}
+UMM_FREE_STATS;
+
+extern void  umm_free_stats( UMM_FREE_STATS *stats );
+
+/* ------------------------------------------------------------------------ */
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,13 +2,17 @@
 #include "graphics/overlay.hpp"
 #include "localization.hpp"
 #include "number/endian.hpp"
+#include "saveKv.hpp"
 #include "string.hpp"
 #include "tileDataStream.hpp"
 #include "umm_malloc/src/umm_malloc.h"
 #include "version.hpp"
+#include <algorithm>
+#include <cstring>
 
 extern "C" {
 #include "lua/lauxlib.h"
+#include "lua/lstate.h"
 #include "lua/lualib.h"
 }
 
@@ -27,13 +31,33 @@ extern "C" {
 static Platform* platform;
 static std::optional<StringBuffer<48>> next_script;
 
-static void* umm_lua_alloc(void*, void* ptr, size_t, size_t nsize)
+// Bytes of heap currently allocated by Lua, and the most that Lua has
+// allocated at once, for meminfo().
+static u32 lua_memory;
+static u32 lua_memory_peak;
+
+
+static void* umm_lua_alloc(void*, void* ptr, size_t osize, size_t nsize)
 {
+    if (ptr == nullptr) {
+        // When allocating a new object, Lua passes the type of the object in
+        // osize, rather than a size.
+        osize = 0;
+    }
+
     if (nsize == 0) {
         umm_free(ptr);
+        lua_memory -= osize;
         return nullptr;
     } else {
-        return umm_realloc(ptr, nsize);
+        auto result = umm_realloc(ptr, nsize);
+        if (result) {
+            lua_memory += nsize - osize;
+            if (lua_memory > lua_memory_peak) {
+                lua_memory_peak = lua_memory;
+            }
+        }
+        return result;
     }
 }
 
@@ -81,7 +105,8 @@ struct Entity
     u8 anim_len_ : 4;
     u8 anim_rate_ : 4;
     u8 del_after_anim_ : 1;
-    u8 flags_ : 7;
+    u8 size_ : 4;
+    u8 flags_ : 3;
 
 
     bool overlapping(Entity& other)
@@ -113,21 +138,24 @@ struct Entity
                anim_start_(0),
                anim_len_(0),
                anim_rate_(0),
-               del_after_anim_(0) {}
+               del_after_anim_(0),
+               size_(Sprite::Size::w16_h16) {}
 };
 using EntityPtr = std::unique_ptr<Entity, void (*)(Entity*)>;
 
 
 
-static constexpr int entity_count = 128;
+// With the sprite multiplexer enabled, the platform can display more than 128
+// sprites, so we allow more entities than the hardware has object slots.
+static constexpr int entity_count = 256;
 
 
 
-ObjectPool<Entity, entity_count> entity_pool;
+SLOW_RAM_DATA ObjectPool<Entity, entity_count> entity_pool;
 
 
 
-Buffer<EntityPtr, entity_count> entity_buffer;
+SLOW_RAM_DATA Buffer<EntityPtr, entity_count> entity_buffer;
 
 
 
@@ -258,6 +286,377 @@ static inline const char* fill_tilemap(const Filesystem::FileData& f,
 }
 
 
+// Load a script from the resource bundle, decompressing it first if build.lua
+// compressed it. Returns the same status codes as luaL_loadstring().
+static int
+load_script(lua_State* L, const Filesystem::FileData& f, const char* name)
+{
+    const u32 size = decompress(f, nullptr);
+    if (size == 0) {
+        return luaL_loadstring(L, f.data_);
+    }
+
+    auto buffer = (char*)umm_malloc(size);
+    if (buffer == nullptr) {
+        lua_pushstring(L, "not enough memory to decompress script");
+        return LUA_ERRMEM;
+    }
+
+    decompress(f, buffer);
+    const int result = luaL_loadbuffer(L, buffer, size, name);
+    umm_free(buffer);
+
+    return result;
+}
+
+
+// Streaming maps: for levels larger than the 64x64 tile map layers. The engine
+// treats each map layer as a ring buffer, where map tile (x, y) lives in layer
+// tile (x % 64, y % 64), and when the camera moves, copies the newly exposed
+// rows and columns into the ring. The map data comes from a binary .map file,
+// which build.lua generates from a csv file (two little-endian u16 values for
+// width and height, followed by a u16 for each tile, row by row).
+struct MapStream {
+    const u8* data_ = nullptr;
+    int width_ = 0;
+    int height_ = 0;
+
+    // Holds the map data, if build.lua compressed the map file.
+    u8* buffer_ = nullptr;
+
+    // The block of the map currently loaded into the layer, inclusive.
+    bool loaded_ = false;
+    int x0_ = 0;
+    int y0_ = 0;
+    int x1_ = 0;
+    int y1_ = 0;
+
+    // The scroll() offset for the layer, which we need to account for when
+    // figuring out which part of the map is visible.
+    s16 scroll_x_ = 0;
+    s16 scroll_y_ = 0;
+};
+
+
+// Indexed by layer - 1 (map_1, map_0).
+static MapStream map_streams[2];
+
+
+static MapStream* map_stream(int layer)
+{
+    if (layer == (int)Layer::map_1 or layer == (int)Layer::map_0) {
+        return &map_streams[layer - 1];
+    }
+    return nullptr;
+}
+
+
+static void map_stream_copy(int layer,
+                            const MapStream& m,
+                            int x0,
+                            int y0,
+                            int x1,
+                            int y1)
+{
+    for (int y = y0; y <= y1; ++y) {
+        auto row = m.data_ + 4 + y * m.width_ * 2;
+        for (int x = x0; x <= x1; ++x) {
+            const u16 t = row[x * 2] | (row[x * 2 + 1] << 8);
+            platform->set_tile((Layer)layer, x % 64, y % 64, t);
+        }
+    }
+}
+
+
+static void map_stream_update(int layer)
+{
+    auto& m = map_streams[layer - 1];
+    if (m.data_ == nullptr) {
+        return;
+    }
+
+    // A couple tiles of margin around the screen, so that the next row or
+    // column is already in place by the time that it scrolls into view.
+    static const int margin = 2;
+
+    const auto view = platform->screen().get_view().get_center().cast<s32>();
+    const int px = view.x + m.scroll_x_;
+    const int py = view.y + m.scroll_y_;
+
+    // NOTE: shift rather than divide, to round negative coordinates down.
+    const int x0 = std::max((px >> 3) - margin, 0);
+    const int y0 = std::max((py >> 3) - margin, 0);
+    const int x1 = std::min((px >> 3) + 30 + margin, m.width_ - 1);
+    const int y1 = std::min((py >> 3) + 20 + margin, m.height_ - 1);
+
+    if (x0 > x1 or y0 > y1) {
+        return;
+    }
+
+    if (not m.loaded_ or x0 > m.x1_ or x1 < m.x0_ or y0 > m.y1_ or
+        y1 < m.y0_) {
+        map_stream_copy(layer, m, x0, y0, x1, y1);
+    } else {
+        // Newly exposed columns...
+        if (x0 < m.x0_) {
+            map_stream_copy(layer, m, x0, y0, m.x0_ - 1, y1);
+        }
+        if (x1 > m.x1_) {
+            map_stream_copy(layer, m, m.x1_ + 1, y0, x1, y1);
+        }
+
+        // ...and rows, excluding the corners, which we just copied.
+        const int cx0 = std::max(x0, m.x0_);
+        const int cx1 = std::min(x1, m.x1_);
+        if (y0 < m.y0_) {
+            map_stream_copy(layer, m, cx0, y0, cx1, m.y0_ - 1);
+        }
+        if (y1 > m.y1_) {
+            map_stream_copy(layer, m, cx0, m.y1_ + 1, cx1, y1);
+        }
+    }
+
+    m.loaded_ = true;
+    m.x0_ = x0;
+    m.y0_ = y0;
+    m.x1_ = x1;
+    m.y1_ = y1;
+}
+
+
+static Sprite::Size to_sprite_size(lua_State* L, int arg)
+{
+    const int size = lua_tointeger(L, arg);
+    if (size < 0 or size >= Sprite::size_count) {
+        luaL_error(L, "invalid sprite size %d", size);
+    }
+    if (auto err = platform->screen().check_sprite_size((Sprite::Size)size)) {
+        luaL_error(L, "%s", err->c_str());
+    }
+    return (Sprite::Size)size;
+}
+
+
+// Retained text labels, for hud text that a script redraws every frame. A
+// label remembers where it lives, and only rewrites the overlay tiles that
+// changed since the last call to labelset().
+static const int label_count = 32;
+static std::optional<Text> labels[label_count];
+
+
+static Text* to_label(lua_State* L, int arg)
+{
+    auto lbl = (Text*)lua_topointer(L, arg);
+    for (auto& l : labels) {
+        if (l and &*l == lbl) {
+            return lbl;
+        }
+    }
+    luaL_error(L, "invalid label");
+    return nullptr;
+}
+
+
+static Text::OptColors to_font_colors(lua_State* L, int arg)
+{
+    Text::OptColors c;
+    if (lua_gettop(L) >= arg) {
+        c.emplace();
+        c->foreground_ = static_cast<ColorConstant>(lua_tointeger(L, arg));
+        c->background_ = ColorConstant::null;
+    }
+    if (lua_gettop(L) > arg) {
+        c->background_ = static_cast<ColorConstant>(lua_tointeger(L, arg + 1));
+    }
+    return c;
+}
+
+
+// Scripts persist values with save_put() and save_get(). We keep the whole
+// key/value store in a buffer in ram, serialized in a compact tagged binary
+// format, and write the buffer out to the cartridge during the next call to
+// display(), in a single commit, however many values the script saved during
+// the frame. On flash cartridges, the platform only rewrites the parts of the
+// buffer that changed. See saveKv.hpp for the layout of the buffer.
+static const int save_kv_size = 4000;
+
+
+SLOW_RAM_DATA alignas(4) static u8 save_kv[save_kv_size];
+static SaveEntries save_kv_entries{save_kv + save_kv_header,
+                                   save_kv_size - save_kv_header};
+static bool save_kv_loaded = false;
+static bool save_kv_dirty = false;
+
+
+static void save_kv_load()
+{
+    if (save_kv_loaded) {
+        return;
+    }
+
+    save_kv_loaded = true;
+
+    if (not platform->read_save_data(save_kv, save_kv_size)) {
+        return;
+    }
+
+    const int length = save_kv_verify(save_kv, save_kv_size);
+    if (length not_eq -1) {
+        save_kv_entries.length_ = length;
+    }
+}
+
+
+static void save_kv_flush()
+{
+    if (not save_kv_dirty) {
+        return;
+    }
+
+    save_kv_seal(save_kv, save_kv_entries.length_);
+
+    if (not platform->write_save_data(
+            save_kv, save_kv_header + save_kv_entries.length_)) {
+        warning(*platform, "failed to write save data");
+    }
+
+    save_kv_dirty = false;
+}
+
+
+// Byte buffers hold binary data, e.g. network packets or save data, so that
+// scripts can read and write fields in place, rather than creating a new lua
+// string for every packet and unpacking it with string.byte(). A buffer has a
+// fixed size, set when the script creates it. A slice shares its memory with
+// the buffer that it came from, and keeps that buffer alive.
+struct ByteBuffer {
+    u8* data_;
+    u32 size_;
+
+    // Followed by size_ bytes of data, unless the buffer is a slice.
+};
+
+
+static const char* const byte_buffer_type = "bpcore.buffer";
+
+
+static ByteBuffer* push_byte_buffer(lua_State* L, u32 size)
+{
+    auto buf = (ByteBuffer*)lua_newuserdatauv(L, sizeof(ByteBuffer) + size, 1);
+    buf->data_ = (u8*)(buf + 1);
+    buf->size_ = size;
+    memset(buf->data_, 0, size);
+
+    luaL_setmetatable(L, byte_buffer_type);
+
+    return buf;
+}
+
+
+static ByteBuffer* to_byte_buffer(lua_State* L, int arg)
+{
+    return (ByteBuffer*)luaL_checkudata(L, arg, byte_buffer_type);
+}
+
+
+// Accessors take the size of the field in bytes, negative for signed fields.
+// Fields are little-endian, and need not be aligned.
+static u8*
+byte_buffer_field(lua_State* L, ByteBuffer* buf, int offset, int type)
+{
+    const int width = type < 0 ? -type : type;
+    if (width not_eq 1 and width not_eq 2 and width not_eq 4) {
+        luaL_error(L, "invalid buffer field type %d", type);
+    }
+    // Compare without adding to offset, which a script could pick to overflow.
+    if (offset < 0 or u32(offset) > buf->size_ or
+        u32(width) > buf->size_ - u32(offset)) {
+        luaL_error(L, "buffer offset %d out of bounds", offset);
+    }
+    return buf->data_ + offset;
+}
+
+
+// Scripts may use the first 32000 bytes of cartridge ram, from 0x0E000000.
+static const lua_Integer sram_script_start = 0x0E000000;
+static const lua_Integer sram_script_end = sram_script_start + 32000;
+
+
+// Whether count bytes from addr all lie within the scripts' part of sram.
+// Compares without adding to addr, which a script could pick to overflow.
+static bool sram_range(lua_Integer addr, lua_Integer count)
+{
+    return addr >= sram_script_start and addr < sram_script_end and
+           count >= 0 and count <= sram_script_end - addr;
+}
+
+
+struct MemInfo
+{
+    UMM_FREE_STATS heap_;
+    int heap_fragmentation_;
+    int gc_debt_;
+};
+
+
+static MemInfo meminfo(lua_State* L)
+{
+    MemInfo info;
+    umm_free_stats(&info.heap_);
+
+    // The same fragmentation metric as umm_info(): zero when all of the free
+    // memory sits in one block, approaching 100 as the free memory splits into
+    // many small blocks.
+    info.heap_fragmentation_ = 0;
+    if (info.heap_.freeBlocks) {
+        const auto root = sqrt_approx((float)info.heap_.freeBlocksSquared);
+        info.heap_fragmentation_ =
+            100 - (int)(root * 100 / info.heap_.freeBlocks + 0.5f);
+    }
+
+    info.gc_debt_ = G(L)->GCdebt;
+
+    return info;
+}
+
+
+// When non-zero, display() logs a line of memory statistics once every
+// memlog_interval frames.
+static int memlog_interval;
+static int memlog_counter;
+
+
+static void memlog(lua_State* L)
+{
+    const auto mem = meminfo(L);
+
+    StringBuffer<160> str;
+    char buf[12];
+
+    auto append = [&](const char* label, int num) {
+        english__to_string(num, buf, 10);
+        str += label;
+        str += buf;
+    };
+
+    append("heap free ", mem.heap_.freeBytes);
+    append(" largest ", mem.heap_.maxFreeBytes);
+    append(" frag ", mem.heap_fragmentation_);
+    append("% lua ", lua_memory);
+    append(" peak ", lua_memory_peak);
+    append(" debt ", mem.gc_debt_);
+    append(" ents ", entity_buffer.size());
+    append("/", entity_count);
+    append(" sbr ",
+           Platform::scratch_buffer_count -
+               platform->scratch_buffers_remaining());
+    append(" peak ", platform->scratch_buffer_highwater());
+
+    info(*platform, str.c_str());
+}
+
+
+
 static const struct {
     const char* name_;
     int (*callback_)(lua_State*);
@@ -345,12 +744,12 @@ static const struct {
     {"dofile",
      [](lua_State* L) -> int {
          auto fname = lua_tostring(L, 1);
-         auto script = platform->fs().get_file(fname).data_;
-         if (luaL_loadstring(L, script)) {
-             luaL_error(L, lua_tostring(L, -1));
+         auto script = platform->fs().get_file(fname);
+         if (load_script(L, script, fname)) {
+             luaL_error(L, "%s", lua_tostring(L, -1));
          }
          if (lua_pcall(L, 0, 0, 0)) {
-             luaL_error(L, lua_tostring(L, -1));
+             luaL_error(L, "%s", lua_tostring(L, -1));
              return 1;
          }
          return 0;
@@ -444,15 +843,19 @@ static const struct {
              lua_pushinteger(L, e->sprite_id_);
              lua_pushboolean(L, e->x_flip_);
              lua_pushboolean(L, e->y_flip_);
-             return 3;
+             lua_pushinteger(L, e->size_);
+             return 4;
          } else {
              e->sprite_id_ = lua_tointeger(L, 2);
-             if (argc > 3) {
+             if (argc > 2) {
                  const bool xflip = lua_toboolean(L, 3);
                  e->x_flip_ = xflip;
-                 if (argc > 4) {
+                 if (argc > 3) {
                      const bool yflip = lua_toboolean(L, 4);
                      e->y_flip_ = yflip;
+                     if (argc > 4) {
+                         e->size_ = to_sprite_size(L, 5);
+                     }
                  }
              }
          }
@@ -635,8 +1038,16 @@ static const struct {
          pkt_set_origin(message);
 
 
-         const char* str = lua_tostring(L, 1);
-         const auto len = str_len(str);
+         const char* str;
+         u32 len;
+         if (lua_type(L, 1) == LUA_TUSERDATA) {
+             auto buf = to_byte_buffer(L, 1);
+             str = (const char*)buf->data_;
+             len = buf->size_;
+         } else {
+             str = lua_tostring(L, 1);
+             len = str_len(str);
+         }
 
          if (len > (sizeof message) - 1) {
              lua_pushboolean(L, false);
@@ -688,6 +1099,23 @@ static const struct {
      }},
     {"recv",
      [](lua_State* L) -> int {
+         static const auto msg_size = Platform::NetworkPeer::max_message_size;
+
+         if (lua_gettop(L) > 0) {
+             // Receive into a buffer, rather than creating a new string.
+             auto buf = to_byte_buffer(L, 1);
+             if (buf->size_ < msg_size) {
+                 luaL_error(L, "recv buffer smaller than a message");
+             }
+             auto message = platform->network_peer().poll_message();
+             if (message) {
+                 memcpy(buf->data_, message->data_, msg_size);
+                 platform->network_peer().poll_consume(msg_size);
+             }
+             lua_pushboolean(L, bool(message));
+             return 1;
+         }
+
          if (auto message = platform->network_peer().poll_message()) {
              lua_pushlstring(L, (const char*)message->data_,
                              Platform::NetworkPeer::max_message_size);
@@ -714,6 +1142,7 @@ static const struct {
              spr.set_texture_index(e->sprite_id_);
              spr.set_position({e->x_, e->y_});
              spr.set_flip({(bool)e->x_flip_, (bool)e->y_flip_});
+             spr.set_size((Sprite::Size)e->size_);
              platform->screen().draw(spr);
 
              if (i > 0) {
@@ -728,6 +1157,13 @@ static const struct {
          platform->screen().display();
          platform->keyboard().poll();
 
+         save_kv_flush();
+
+         if (memlog_interval and ++memlog_counter >= memlog_interval) {
+             memlog_counter = 0;
+             memlog(L);
+         }
+
          for (auto it = entity_buffer.begin();
               it not_eq entity_buffer.end();) {
 
@@ -811,6 +1247,36 @@ static const struct {
                    c);
          return 0;
      }},
+    {"label",
+     [](lua_State* L) -> int {
+         for (auto& l : labels) {
+             if (not l) {
+                 l.emplace(*platform,
+                           OverlayCoord{(u8)lua_tointeger(L, 2),
+                                        (u8)lua_tointeger(L, 3)});
+                 l->set(lua_tostring(L, 1), to_font_colors(L, 4));
+                 lua_pushlightuserdata(L, &*l);
+                 return 1;
+             }
+         }
+         luaL_error(L, "label pool exhausted! (max %d)", label_count);
+         return 1;
+     }},
+    {"labelset",
+     [](lua_State* L) -> int {
+         to_label(L, 1)->set(lua_tostring(L, 2), to_font_colors(L, 3));
+         return 0;
+     }},
+    {"labeldel",
+     [](lua_State* L) -> int {
+         auto lbl = to_label(L, 1);
+         for (auto& l : labels) {
+             if (l and &*l == lbl) {
+                 l.reset();
+             }
+         }
+         return 0;
+     }},
     {"syscall",
      [](lua_State* L) -> int {
          lua_pushboolean(L, false);
@@ -853,7 +1319,7 @@ static const struct {
          }
 
          if (err) {
-             luaL_error(L, err->c_str());
+             luaL_error(L, "%s", err->c_str());
              return 1;
          }
 
@@ -869,11 +1335,14 @@ static const struct {
          const int argc = lua_gettop(L);
          if (argc > 3) {
              const bool xflip = lua_toboolean(L, 4);
+             bool yflip = false;
              if (argc > 4) {
-                 bool yflip = lua_toboolean(L, 5);
-                 spr.set_flip({xflip, yflip});
+                 yflip = lua_toboolean(L, 5);
+                 if (argc > 5) {
+                     spr.set_size(to_sprite_size(L, 6));
+                 }
              }
-             spr.set_flip({xflip, false});
+             spr.set_flip({xflip, yflip});
          }
 
          platform->screen().draw(spr);
@@ -899,6 +1368,12 @@ static const struct {
 
          platform->scroll(static_cast<Layer>(l), x, y);
 
+         if (auto m = map_stream(l)) {
+             m->scroll_x_ = x;
+             m->scroll_y_ = y;
+             map_stream_update(l);
+         }
+
          return 0;
      }},
     {"camera",
@@ -914,6 +1389,9 @@ static const struct {
 
          platform->screen().set_view(view);
 
+         map_stream_update((int)Layer::map_1);
+         map_stream_update((int)Layer::map_0);
+
          return 0;
      }},
     {"tile",
@@ -952,6 +1430,84 @@ static const struct {
          }
          return 0;
      }},
+    {"mapstream",
+     [](lua_State* L) -> int {
+         const int l = lua_tointeger(L, 1);
+         auto m = map_stream(l);
+         if (m == nullptr) {
+             return luaL_error(L, "mapstream: layer must be 1 or 2");
+         }
+
+         m->data_ = nullptr;
+         m->loaded_ = false;
+
+         umm_free(m->buffer_);
+         m->buffer_ = nullptr;
+
+         if (lua_gettop(L) < 2) {
+             return 0;
+         }
+
+         const char* filename = lua_tostring(L, 2);
+         if (filename == nullptr) {
+             return luaL_error(L, "null filename passed to mapstream()");
+         }
+
+         auto f = platform->fs().get_file(filename);
+         if (f.data_ == nullptr) {
+             return luaL_error(L, "mapstream src file not found: %s", filename);
+         }
+
+         auto data = (const u8*)f.data_;
+         u32 size = f.size_;
+
+         // We need random access to the map, so a compressed map stays
+         // decompressed in the heap while we're streaming it.
+         if (const u32 unpacked = decompress(f, nullptr)) {
+             m->buffer_ = (u8*)umm_malloc(unpacked);
+             if (m->buffer_ == nullptr) {
+                 return luaL_error(L, "mapstream: out of memory");
+             }
+             decompress(f, m->buffer_);
+             data = m->buffer_;
+             size = unpacked;
+         }
+
+         if (size < 4) {
+             return luaL_error(L, "mapstream: truncated map file");
+         }
+
+         const int w = data[0] | (data[1] << 8);
+         const int h = data[2] | (data[3] << 8);
+
+         if (size < u32(4 + w * h * 2)) {
+             return luaL_error(L, "mapstream: truncated map file");
+         }
+
+         m->data_ = data;
+         m->width_ = w;
+         m->height_ = h;
+
+         map_stream_update(l);
+
+         return 0;
+     }},
+    {"tileanim",
+     [](lua_State* L) -> int {
+         const int l = lua_tointeger(L, 1);
+         const int t = lua_tointeger(L, 2);
+         const int start = lua_tointeger(L, 3);
+         const int len = lua_tointeger(L, 4);
+         const int rate = lua_tointeger(L, 5);
+
+         if ((Layer)l == Layer::overlay) {
+             return luaL_error(L, "tileanim: overlay tiles cannot animate");
+         }
+
+         lua_pushboolean(L,
+                         platform->animate_tile((Layer)l, t, start, len, rate));
+         return 1;
+     }},
     {"tilemap",
      [](lua_State* L) -> int {
          const int argc = lua_gettop(L);
@@ -999,13 +1555,13 @@ static const struct {
          if (f.data_ == nullptr) {
              StringBuffer<60> str = "tilemap src file not found: ";
              str += filename;
-             luaL_error(L, str.c_str());
+             luaL_error(L, "%s", str.c_str());
              return 1;
          }
 
          if (auto err = fill_tilemap(
                  f, layer, width, height, dest_x, dest_y, src_x, src_y)) {
-             luaL_error(L, err);
+             luaL_error(L, "%s", err);
              return 1;
          }
 
@@ -1057,10 +1613,7 @@ static const struct {
              host_u32 output;
              output.set(lua_tointeger(L, 2));
              // SRAM has a single-byte bus.
-             *((u8*)addr++) = ((u8*)&output)[0];
-             *((u8*)addr++) = ((u8*)&output)[1];
-             *((u8*)addr++) = ((u8*)&output)[2];
-             *((u8*)addr++) = ((u8*)&output)[3];
+             sram_copy((void*)addr, &output, sizeof output);
              return 0;
          } else {
              luaL_error(L, "out of bounds address passed to poke4");
@@ -1080,10 +1633,7 @@ static const struct {
          if (UNLIKELY(addr >= 0x0E000000 and addr + 4 < (0x0E000000 + 32000))) {
              host_u32 input;
              // SRAM has a single-byte bus.
-             ((u8*)&input)[0] = *((u8*)addr++);
-             ((u8*)&input)[1] = *((u8*)addr++);
-             ((u8*)&input)[2] = *((u8*)addr++);
-             ((u8*)&input)[3] = *((u8*)addr++);
+             sram_copy(&input, (const void*)addr, sizeof input);
              lua_pushinteger(L, input.get());
          } else {
              lua_pushinteger(L, ((host_u32*)addr)->get());
@@ -1094,7 +1644,14 @@ static const struct {
     {"memput",
      [](lua_State* L) -> int {
          size_t len;
-         auto src = lua_tolstring(L, 2, &len);
+         const char* src;
+         if (lua_type(L, 2) == LUA_TUSERDATA) {
+             auto buf = to_byte_buffer(L, 2);
+             src = (const char*)buf->data_;
+             len = buf->size_;
+         } else {
+             src = lua_tolstring(L, 2, &len);
+         }
          auto dest_addr = lua_tointeger(L, 1);
 
          if (len == 0) {
@@ -1107,12 +1664,9 @@ static const struct {
              memcpy((void*)dest_addr, src, len);
              return 0;
 
-         } else if (dest_addr >= 0x0E000000 and
-                    dest_addr < (0x0E000000 + 32000)) {
+         } else if (sram_range(dest_addr, len)) {
              // SRAM write
-             for (u32 i = 0; i < len; ++i) {
-                 *((u8*)dest_addr++) = src[i];
-             }
+             sram_copy((void*)dest_addr, src, len);
              return 0;
          } else {
              luaL_error(L, "out of bounds address passed to memwrite");
@@ -1126,34 +1680,40 @@ static const struct {
          auto src = lua_tointeger(L, 1);
          const auto count = lua_tointeger(L, 2);
 
-         if (src >= 0x0E000000 and src < (0x0E000000 + 32000)) {
-
-             // SRAM read. We cannot trust lua_pushlstring to load the memory
-             // correctly, because lua doesn't know that the SRAM port has an
-             // 8-bit bus. Copy the data manually, byte-by-byte.
-
-             u8 local_buffer[255];
-
-             u8* dest = local_buffer;
+         if (count < 0) {
+             luaL_error(L, "negative count passed to memget");
+         }
 
-             if ((sizeof local_buffer) < (u32)count) {
-                 dest = (u8*)umm_malloc(count);
-             }
+         const bool sram = src >= sram_script_start and src < sram_script_end;
+         if (sram and not sram_range(src, count)) {
+             luaL_error(L, "memget reads past the end of sram");
+         }
 
-             if (dest == nullptr) {
-                 luaL_error(L, "not enough memory for memget");
-                 return 1;
+         if (lua_gettop(L) > 2) {
+             // Read into a buffer, rather than creating a new string.
+             auto buf = to_byte_buffer(L, 3);
+             if (u32(count) > buf->size_) {
+                 luaL_error(L, "memget count exceeds buffer size");
              }
-
-             for (int i = 0; i < count; ++i) {
-                 dest[i] = *((u8*)src++);
+             if (sram) {
+                 sram_copy(buf->data_, (const void*)src, count);
+             } else {
+                 memcpy(buf->data_, (const void*)src, count);
              }
+             lua_settop(L, 3);
+             return 1;
+         }
 
-             lua_pushlstring(L, (const char*)dest, count);
+         if (sram) {
 
-             if (dest not_eq local_buffer) {
-                 umm_free(dest);
-             }
+             // SRAM read. We cannot trust lua_pushlstring to load the memory
+             // correctly, because lua doesn't know that the SRAM port has an
+             // 8-bit bus. Copy the data straight into lua's string buffer
+             // instead, which lives on the stack for small reads.
+             luaL_Buffer buffer;
+             char* dest = luaL_buffinitsize(L, &buffer, count);
+             sram_copy(dest, (const void*)src, count);
+             luaL_pushresultsize(&buffer, count);
 
              return 1;
          } else {
@@ -1161,6 +1721,126 @@ static const struct {
              return 1;
          }
      }},
+    {"buffer",
+     [](lua_State* L) -> int {
+         if (lua_type(L, 1) == LUA_TSTRING) {
+             size_t len;
+             const char* str = lua_tolstring(L, 1, &len);
+             auto buf = push_byte_buffer(L, len);
+             memcpy(buf->data_, str, len);
+         } else {
+             const auto size = lua_tointeger(L, 1);
+             if (size < 0) {
+                 luaL_error(L, "invalid buffer size");
+             }
+             push_byte_buffer(L, size);
+         }
+         return 1;
+     }},
+    {"bufget",
+     [](lua_State* L) -> int {
+         auto buf = to_byte_buffer(L, 1);
+         const int type = lua_gettop(L) > 2 ? lua_tointeger(L, 3) : 1;
+         auto p = byte_buffer_field(L, buf, lua_tointeger(L, 2), type);
+
+         switch (type) {
+         case 1:
+             lua_pushinteger(L, p[0]);
+             break;
+         case -1:
+             lua_pushinteger(L, s8(p[0]));
+             break;
+         case 2:
+             lua_pushinteger(L, u16(p[0] | (p[1] << 8)));
+             break;
+         case -2:
+             lua_pushinteger(L, s16(p[0] | (p[1] << 8)));
+             break;
+         default:
+             lua_pushinteger(
+                 L,
+                 lua_Integer(p[0] | (p[1] << 8) | (p[2] << 16) |
+                             (u32(p[3]) << 24)));
+             break;
+         }
+         return 1;
+     }},
+    {"bufset",
+     [](lua_State* L) -> int {
+         auto buf = to_byte_buffer(L, 1);
+         const int type = lua_gettop(L) > 3 ? lua_tointeger(L, 4) : 1;
+         auto p = byte_buffer_field(L, buf, lua_tointeger(L, 2), type);
+         const u32 value = lua_tointeger(L, 3);
+
+         const int width = type < 0 ? -type : type;
+         for (int i = 0; i < width; ++i) {
+             p[i] = value >> (i * 8);
+         }
+         return 0;
+     }},
+    {"bufslice",
+     [](lua_State* L) -> int {
+         auto buf = to_byte_buffer(L, 1);
+         const lua_Integer offset = lua_tointeger(L, 2);
+         if (offset < 0 or u32(offset) > buf->size_) {
+             luaL_error(L, "buffer slice out of bounds");
+         }
+
+         // NOTE: keep count signed until we've checked it. Mixing it with the
+         // u32 size would turn a negative count into a huge one.
+         const lua_Integer count = lua_gettop(L) > 2
+                                       ? lua_tointeger(L, 3)
+                                       : lua_Integer(buf->size_ - offset);
+         if (count < 0 or u32(count) > buf->size_ - u32(offset)) {
+             luaL_error(L, "buffer slice out of bounds");
+         }
+
+         auto slice = (ByteBuffer*)lua_newuserdatauv(L, sizeof(ByteBuffer), 1);
+         slice->data_ = buf->data_ + offset;
+         slice->size_ = count;
+         luaL_setmetatable(L, byte_buffer_type);
+
+         // The slice points into the parent's memory, so keep the parent
+         // alive for as long as the slice exists.
+         lua_pushvalue(L, 1);
+         lua_setiuservalue(L, -2, 1);
+
+         return 1;
+     }},
+    {"bufstr",
+     [](lua_State* L) -> int {
+         auto buf = to_byte_buffer(L, 1);
+         lua_pushlstring(L, (const char*)buf->data_, buf->size_);
+         return 1;
+     }},
+    {"save_put",
+     [](lua_State* L) -> int {
+         size_t key_len;
+         const char* key = lua_tolstring(L, 1, &key_len);
+         if (key == nullptr or lua_type(L, 1) not_eq LUA_TSTRING) {
+             luaL_error(L, "save_put: key must be a string");
+         }
+
+         save_kv_load();
+         save_kv_entries.put(L, key, key_len, 2);
+
+         save_kv_dirty = true;
+
+         return 0;
+     }},
+    {"save_get",
+     [](lua_State* L) -> int {
+         size_t key_len;
+         const char* key = lua_tolstring(L, 1, &key_len);
+         if (key == nullptr) {
+             luaL_error(L, "save_get: key must be a string");
+         }
+
+         save_kv_load();
+         save_kv_entries.get(L, key, key_len);
+
+         return 1;
+     }},
     {"music",
      [](lua_State* L) -> int {
          const int argc = lua_gettop(L);
@@ -1182,7 +1862,24 @@ static const struct {
          }
          const auto name = lua_tostring(L, 1);
          const auto offset = lua_tointeger(L, 2);
-         platform->speaker().play_music(name, offset);
+         Platform::Speaker::MusicOptions options;
+         if (argc > 2) {
+             options.fade_ = lua_tointeger(L, 3);
+         }
+         if (argc > 3) {
+             options.loop_start_ = lua_tointeger(L, 4);
+         }
+         platform->speaker().play_music(name, offset, options);
+         return 0;
+     }},
+    {"music_next",
+     [](lua_State* L) -> int {
+         Platform::Speaker::MusicOptions options;
+         options.queue_ = true;
+         if (lua_gettop(L) > 1) {
+             options.loop_start_ = lua_tointeger(L, 2);
+         }
+         platform->speaker().play_music(lua_tostring(L, 1), 0, options);
          return 0;
      }},
     {"stop_music",
@@ -1194,9 +1891,44 @@ static const struct {
      [](lua_State* L) -> int {
          const auto name = lua_tostring(L, 1);
          const auto priority = lua_tointeger(L, 2);
-         platform->speaker().play_sound(name, priority);
+         auto& speaker = platform->speaker();
+         const auto sound = speaker.play_sound(name, priority);
+         if (sound == Platform::Speaker::null_sound) {
+             lua_pushnil(L);
+             return 1;
+         }
+         if (lua_gettop(L) > 2) {
+             speaker.set_volume(sound, Float(lua_tonumber(L, 3)));
+         }
+         if (lua_gettop(L) > 3) {
+             speaker.set_pan(sound, Float(lua_tonumber(L, 4)));
+         }
+         lua_pushinteger(L, sound);
+         return 1;
+     }},
+    {"sound_volume",
+     [](lua_State* L) -> int {
+         platform->speaker().set_volume(lua_tointeger(L, 1),
+                                        Float(lua_tonumber(L, 2)));
+         return 0;
+     }},
+    {"sound_pan",
+     [](lua_State* L) -> int {
+         platform->speaker().set_pan(lua_tointeger(L, 1),
+                                     Float(lua_tonumber(L, 2)));
          return 0;
      }},
+    {"sound_stop",
+     [](lua_State* L) -> int {
+         platform->speaker().stop_sound(lua_tointeger(L, 1));
+         return 0;
+     }},
+    {"sound_playing",
+     [](lua_State* L) -> int {
+         lua_pushboolean(L,
+                         platform->speaker().is_playing(lua_tointeger(L, 1)));
+         return 1;
+     }},
     {"sleep",
      [](lua_State* L) -> int {
          platform->sleep(lua_tointeger(L, 1));
@@ -1252,6 +1984,66 @@ static const struct {
          platform->feed_watchdog();
          return 0;
      }},
+    {"sprstat",
+     [](lua_State* L) -> int {
+         const auto stats = platform->screen().sprite_cache_stats();
+         lua_pushinteger(L, stats.uploads_);
+         lua_pushinteger(L, stats.hits_);
+         lua_pushinteger(L, stats.misses_);
+         return 3;
+     }},
+    {"ovlstat",
+     [](lua_State* L) -> int {
+         lua_pushinteger(L, platform->screen().overlay_copy_bytes());
+         return 1;
+     }},
+    {"meminfo",
+     [](lua_State* L) -> int {
+         const auto mem = meminfo(L);
+
+         // Fill in the caller's table, if they passed one, so that calling
+         // meminfo() every frame doesn't itself create garbage.
+         if (lua_istable(L, 1)) {
+             lua_settop(L, 1);
+         } else {
+             lua_settop(L, 0);
+             lua_createtable(L, 0, 12);
+         }
+
+         auto field = [L](const char* name, lua_Integer value) {
+             lua_pushinteger(L, value);
+             lua_setfield(L, 1, name);
+         };
+
+         field("heap_size", mem.heap_.heapBytes);
+         field("heap_free", mem.heap_.freeBytes);
+         field("heap_largest", mem.heap_.maxFreeBytes);
+         field("heap_fragments", mem.heap_.freeEntries);
+         field("heap_fragmentation", mem.heap_fragmentation_);
+         field("lua_memory", lua_memory);
+         field("lua_peak", lua_memory_peak);
+         field("gc_debt", mem.gc_debt_);
+         field("entities", entity_buffer.size());
+         field("entity_limit", entity_count);
+         field("scratch_buffers",
+               Platform::scratch_buffer_count -
+                   platform->scratch_buffers_remaining());
+         field("scratch_peak", platform->scratch_buffer_highwater());
+
+         return 1;
+     }},
+    {"memlog",
+     [](lua_State* L) -> int {
+         memlog_interval = lua_tointeger(L, 1);
+         memlog_counter = 0;
+         return 0;
+     }},
+    {"feature",
+     [](lua_State* L) -> int {
+         platform->enable_feature(luaL_checkstring(L, 1),
+                                  lua_gettop(L) < 2 or lua_toboolean(L, 2));
+         return 0;
+     }},
     {"next_script",
      [](lua_State* L) -> int {
          ::next_script = lua_tostring(L, 1);
@@ -1296,6 +2088,10 @@ static const struct {
 
 static void fatal_error(const char* heading, const char* error)
 {
+    // The error screen waits for the watchdog to reset the console, so this is
+    // our last chance to write out the script's saved values.
+    save_kv_flush();
+
     platform->load_overlay_texture("overlay_text_key", 0, 0);
 
     platform->speaker().stop_music();
@@ -1363,6 +2159,9 @@ BPCoreEngine::BPCoreEngine(Platform& pf) : lua_(nullptr)
 
     while (next_script) {
         if (lua_) {
+            // The store outlives the script, but the previous script's writes
+            // shouldn't have to wait for the next script to call display().
+            save_kv_flush();
             lua_close(lua_);
         }
 
@@ -1376,6 +2175,14 @@ BPCoreEngine::BPCoreEngine(Platform& pf) : lua_(nullptr)
             lua_setglobal(lua_, builtin.name_);
         }
 
+        luaL_newmetatable(lua_, byte_buffer_type);
+        lua_pushcfunction(lua_, [](lua_State* L) -> int {
+            lua_pushinteger(L, to_byte_buffer(L, 1)->size_);
+            return 1;
+        });
+        lua_setfield(lua_, -2, "__len");
+        lua_pop(lua_, 1);
+
         lua_pushinteger(lua_, (intptr_t)__ram);
         lua_setglobal(lua_, "_IRAM");
         lua_pushinteger(lua_, (intptr_t)(byte*)0x0E000000);
@@ -1403,8 +2210,9 @@ BPCoreEngine::BPCoreEngine(Platform& pf) : lua_(nullptr)
             lua_setglobal(lua_, "_BP_VERSION");
         }
 
-        if (auto script = pf.fs().get_file(next_script->c_str()).data_) {
-            if (luaL_loadstring(lua_, script)) {
+        auto script = pf.fs().get_file(next_script->c_str());
+        if (script.data_) {
+            if (load_script(lua_, script, next_script->c_str())) {
                 fatal_error("Fatal Error: ", lua_tostring(lua_, -1));
             }
         }
@@ -1420,5 +2228,8 @@ void BPCoreEngine::run()
 {
     auto& pf = *platform;
 
+    // The last script finished, and we're about to reset.
+    save_kv_flush();
+
     pf.fatal();
 }
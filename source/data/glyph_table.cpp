@@ -0,0 +1,704 @@
+// Generated by build/gen_glyph_table.py, from build/charset_mapping.txt.
+// Do not edit by hand.
+
+#include "number/int.h"
+
+
+// Indexed by ascii value, zero for characters without a glyph.
+extern const u16 glyph_table_ascii[128] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 72, 94, 65, 105,
+    0, 93, 2761, 66, 69, 70, 101, 98, 38, 99, 37, 100,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 71, 2753,
+    103, 102, 104, 95, 0, 39, 40, 41, 42, 43, 44, 45,
+    46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+    58, 59, 60, 61, 62, 63, 64, 67, 0, 68, 0, 186,
+    0, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 0, 0, 0, 0, 0,
+};
+
+
+// Packed utf-8 codepoints, sorted.
+extern const u32 glyph_table_keys[2688] = {
+    0x000080c3, 0x000080d1, 0x000081d1, 0x000082c3, 0x000082d1, 0x000083c3,
+    0x000083d1, 0x000084c3, 0x000084d1, 0x000085c3, 0x000085d1, 0x000086c3,
+    0x000086d1, 0x000087c3, 0x000087d1, 0x000088c3, 0x000088d1, 0x000089c3,
+    0x000089d1, 0x00008ac3, 0x00008ad1, 0x00008bd1, 0x00008cd1, 0x00008dd1,
+    0x00008ed1, 0x00008fd1, 0x000090d0, 0x000091d0, 0x000092d0, 0x000093d0,
+    0x000094d0, 0x000095d0, 0x000096d0, 0x000097d0, 0x000098c3, 0x000098d0,
+    0x000099d0, 0x00009ad0, 0x00009bd0, 0x00009cd0, 0x00009dd0, 0x00009ed0,
+    0x00009fd0, 0x0000a0c3, 0x0000a0d0, 0x0000a1c2, 0x0000a1c3, 0x0000a1d0,
+    0x0000a2c3, 0x0000a2d0, 0x0000a3d0, 0x0000a4d0, 0x0000a5d0, 0x0000a6d0,
+    0x0000a7c3, 0x0000a7d0, 0x0000a8c3, 0x0000a8d0, 0x0000a9c2, 0x0000a9c3,
+    0x0000a9d0, 0x0000aac3, 0x0000aad0, 0x0000abc3, 0x0000abd0, 0x0000acd0,
+    0x0000adc3, 0x0000add0, 0x0000aec3, 0x0000aed0, 0x0000afc3, 0x0000afd0,
+    0x0000b0d0, 0x0000b1c3, 0x0000b1d0, 0x0000b2d0, 0x0000b3c3, 0x0000b3d0,
+    0x0000b4c3, 0x0000b4d0, 0x0000b5d0, 0x0000b6c3, 0x0000b6d0, 0x0000b7d0,
+    0x0000b8c3, 0x0000b8d0, 0x0000b9c3, 0x0000b9d0, 0x0000bac3, 0x0000bad0,
+    0x0000bbc3, 0x0000bbd0, 0x0000bcc3, 0x0000bcd0, 0x0000bdd0, 0x0000bed0,
+    0x0000bfc2, 0x0000bfd0, 0x008080e6, 0x008080e8, 0x008080e9, 0x008082e9,
+    0x008083e3, 0x008083e8, 0x008086e8, 0x008087e5, 0x008088e5, 0x008089e6,
+    0x00808ae6, 0x00808ce5, 0x00808ee6, 0x008091e5, 0x008093e5, 0x008094e6,
+    0x008094e9, 0x008098e9, 0x00809ae8, 0x00809be9, 0x00809ce6, 0x00809ce9,
+    0x00809de5, 0x00809de6, 0x00809de7, 0x0080a1e7, 0x0080a1e8, 0x0080a3e6,
+    0x0080a7e7, 0x0080a8e7, 0x0080a8e8, 0x0080aee7, 0x0080b1e5, 0x0080b7e6,
+    0x0080b8e4, 0x0080bbe4, 0x0080bce5, 0x0080bee5, 0x0080bfe6, 0x008180e6,
+    0x008180e8, 0x008180e9, 0x008183e3, 0x008183e8, 0x008183e9, 0x008184e6,
+    0x008185e5, 0x008189e6, 0x00818ae7, 0x00818ce6, 0x00818de5, 0x008190e5,
+    0x008193e5, 0x008193e9, 0x008194e9, 0x008197e6, 0x008198e9, 0x00819ae8,
+    0x00819be9, 0x00819ce7, 0x00819de7, 0x00819ee6, 0x0081a0e7, 0x0081a2e6,
+    0x0081a2e8, 0x0081a2e9, 0x0081a3e5, 0x0081a3e7, 0x0081a3e8, 0x0081a4e7,
+    0x0081a6e7, 0x0081a6e8, 0x0081a7e7, 0x0081a7e8, 0x0081a8e5, 0x0081aae7,
+    0x0081abe5, 0x0081aee5, 0x0081afe6, 0x0081afe8, 0x0081b0e5, 0x0081b0e8,
+    0x0081b1e5, 0x0081b1e6, 0x0081b2e5, 0x0081b2e9, 0x0081b4e6, 0x0081b5e6,
+    0x0081b6e8, 0x0081b8e4, 0x0081b8e5, 0x0081b9e7, 0x0081bae8, 0x0081bbe4,
+    0x0081bce4, 0x0081bee5, 0x0081bfe7, 0x0081bfe8, 0x008280e3, 0x008280e9,
+    0x008281e9, 0x008283e3, 0x008283e7, 0x008284e8, 0x008287e6, 0x008287e8,
+    0x008289e5, 0x00828ae8, 0x00828be7, 0x00828ce6, 0x00828ce8, 0x00828ee5,
+    0x00828fe5, 0x008296e5, 0x008298e6, 0x00829ae6, 0x00829ae7, 0x00829ae8,
+    0x00829ce8, 0x00829de6, 0x00829ee5, 0x0082a0e5, 0x0082a0e7, 0x0082a1e6,
+    0x0082a2e9, 0x0082a3e8, 0x0082a6e5, 0x0082a6e6, 0x0082a7e8, 0x0082aae9,
+    0x0082abe5, 0x0082ade9, 0x0082afe5, 0x0082b1e5, 0x0082b1e6, 0x0082b2e5,
+    0x0082b6e6, 0x0082b8e5, 0x0082bce5, 0x0082bce6, 0x008380e8, 0x008380e9,
+    0x008382e8, 0x008383e3, 0x008383e8, 0x008385e5, 0x008387e7, 0x00838be5,
+    0x00838ce8, 0x00838de5, 0x008390e5, 0x008390e7, 0x008392e7, 0x008393e9,
+    0x008399e6, 0x00839de6, 0x00839ee5, 0x00839fe5, 0x0083a1e6, 0x0083a2e5,
+    0x0083a8e5, 0x0083aae7, 0x0083aee5, 0x0083b0e8, 0x0083b2e6, 0x0083b7e8,
+    0x0083b8e4, 0x0083b8e5, 0x0083b9e4, 0x0083bae6, 0x0083bbe7, 0x0083bce5,
+    0x0083bee8, 0x0083bfe4, 0x0083bfe5, 0x008482e6, 0x008483e3, 0x008485e5,
+    0x00848ae6, 0x00848ce8, 0x00848ee7, 0x008490e5, 0x008490e8, 0x008491e6,
+    0x008493e5, 0x008493e8, 0x008496e5, 0x008496e8, 0x008499e9, 0x00849ae7,
+    0x00849be9, 0x00849ee5, 0x00849ee6, 0x00849fe6, 0x0084a2e9, 0x0084a4e5,
+    0x0084a7e8, 0x0084aae7, 0x0084aae9, 0x0084afe5, 0x0084afe8, 0x0084b0e5,
+    0x0084b3e6, 0x0084b3e9, 0x0084b5e8, 0x0084b9e8, 0x0084bae5, 0x0084bbe7,
+    0x0084bbe9, 0x0084bce5, 0x0084bee5, 0x0084bee9, 0x0084bfe4, 0x008580e8,
+    0x008582e5, 0x008583e3, 0x008583e6, 0x008585e5, 0x008586e5, 0x008588e8,
+    0x00858be6, 0x00858ce5, 0x00858ce8, 0x00858ee5, 0x008590e6, 0x008593e9,
+    0x008594e9, 0x008595e6, 0x008595e7, 0x008597e5, 0x008597e6, 0x008597e7,
+    0x008598e9, 0x008599e9, 0x00859be9, 0x00859ee7, 0x0085a1e7, 0x0085a2e6,
+    0x0085a3e8, 0x0085a4e6, 0x0085aee5, 0x0085afe6, 0x0085b1e5, 0x0085b5e6,
+    0x0085b6e8, 0x0085b8e5, 0x0085b8e6, 0x0085b9e4, 0x0085b9e5, 0x0085b9e9,
+    0x0085bbe4, 0x0085bee5, 0x0085bee8, 0x0085bfe5, 0x0085bfe7, 0x0085bfe8,
+    0x008680e9, 0x008683e3, 0x008683e8, 0x008684e8, 0x008685e5, 0x008687e5,
+    0x008688e5, 0x008688e7, 0x00868be6, 0x00868ce5, 0x00868ee5, 0x008690e7,
+    0x008691e5, 0x008691e6, 0x008695e5, 0x008696e7, 0x008698e6, 0x008699e9,
+    0x00869ae7, 0x00869ae9, 0x00869be7, 0x00869be9, 0x00869ce5, 0x00869de6,
+    0x0086a0e5, 0x0086a2e9, 0x0086a6e8, 0x0086a6e9, 0x0086a7e5, 0x0086a7e8,
+    0x0086a9e5, 0x0086a9e7, 0x0086aae9, 0x0086afe5, 0x0086afe8, 0x0086b0e5,
+    0x0086b1e8, 0x0086b5e6, 0x0086b8e5, 0x0086bae4, 0x0086bae5, 0x0086bbe7,
+    0x0086bce6, 0x0086bde4, 0x0086bee8, 0x0086bfe5, 0x008781e5, 0x008781e9,
+    0x008783e3, 0x008786e9, 0x008787e9, 0x008788e5, 0x008789e6, 0x008789e7,
+    0x008789e8, 0x00878be5, 0x00878be6, 0x00878ce6, 0x00878de5, 0x00878ee7,
+    0x00878fe8, 0x008791e6, 0x008793e5, 0x008794e5, 0x008795e9, 0x008796e5,
+    0x008796e6, 0x008797e7, 0x00879ae7, 0x00879be8, 0x00879ce9, 0x00879de5,
+    0x00879de8, 0x0087a0e6, 0x0087a2e9, 0x0087a4e5, 0x0087a5e5, 0x0087a6e5,
+    0x0087a8e5, 0x0087ade6, 0x0087aee5, 0x0087afe7, 0x0087b1e6, 0x0087b4e5,
+    0x0087b5e6, 0x0087b8e4, 0x0087bbe4, 0x0087bbe7, 0x0087bfe8, 0x008883e3,
+    0x008883e7, 0x008884e6, 0x008885e5, 0x008885e6, 0x008888e6, 0x008889e7,
+    0x00888ce5, 0x00888de5, 0x00888ee6, 0x00888fe5, 0x008890e5, 0x008891e5,
+    0x008892e9, 0x008893e5, 0x008895e6, 0x008899e9, 0x00889be7, 0x00889ce5,
+    0x00889ce6, 0x0088a1e6, 0x0088a2e9, 0x0088a5e5, 0x0088a6e5, 0x0088a7e8,
+    0x0088aee5, 0x0088b0e8, 0x0088b1e5, 0x0088b6e6, 0x0088b8e4, 0x0088b8e5,
+    0x0088b9e4, 0x0088b9e8, 0x0088bae4, 0x0088bbe7, 0x0088bee5, 0x0088bee8,
+    0x0088bfe8, 0x008980e9, 0x008982e6, 0x008982e7, 0x008982e8, 0x008983e3,
+    0x008984e6, 0x008984e8, 0x008985e5, 0x008986e9, 0x008987e5, 0x00898be5,
+    0x00898be6, 0x00898ce6, 0x00898de6, 0x00898de8, 0x00898ee5, 0x00898ee6,
+    0x00898ee7, 0x00898ee8, 0x00898fe5, 0x008990e5, 0x008992e9, 0x008994e5,
+    0x008996e5, 0x008998e5, 0x00899ce6, 0x00899ce7, 0x00899ce9, 0x00899de6,
+    0x0089a3e6, 0x0089a5e5, 0x0089a7e8, 0x0089aae8, 0x0089ade7, 0x0089aee5,
+    0x0089afe8, 0x0089b1e6, 0x0089b2e6, 0x0089b2e7, 0x0089b3e6, 0x0089b6e6,
+    0x0089b8e4, 0x0089b9e4, 0x0089bae4, 0x0089bae6, 0x0089bbe5, 0x0089bee8,
+    0x008a81e8, 0x008a83e3, 0x008a83e6, 0x008a83e9, 0x008a84e8, 0x008a85e8,
+    0x008a86e7, 0x008a86e8, 0x008a87e9, 0x008a88e5, 0x008a89e5, 0x008a8ae6,
+    0x008a8de5, 0x008a8fe5, 0x008a8fe7, 0x008a8fe8, 0x008a90e5, 0x008a91e5,
+    0x008a91e6, 0x008a95e5, 0x008a96e5, 0x008a9ae8, 0x008a9be5, 0x008a9be7,
+    0x008a9de5, 0x008aaee6, 0x008aafe8, 0x008ab0e5, 0x008ab0e8, 0x008ab1e5,
+    0x008ab3e6, 0x008ab3e7, 0x008ab6e8, 0x008ab8e4, 0x008ab9e9, 0x008abae5,
+    0x008abbe4, 0x008abbe5, 0x008abce4, 0x008abee7, 0x008abfe4, 0x008b81e6,
+    0x008b83e3, 0x008b85e5, 0x008b89e6, 0x008b8ee5, 0x008b8ee7, 0x008b8fe5,
+    0x008b92e8, 0x008b94e9, 0x008b97e6, 0x008b99e6, 0x008b9be8, 0x008b9ce6,
+    0x008b9ce7, 0x008b9ee5, 0x008b9ee9, 0x008b9fe5, 0x008ba2e8, 0x008ba3e6,
+    0x008ba5e5, 0x008ba7e5, 0x008ba7e7, 0x008ba8e7, 0x008babe7, 0x008bace7,
+    0x008bade7, 0x008baee5, 0x008baee6, 0x008bb0e8, 0x008bb1e5, 0x008bb4e6,
+    0x008bb5e6, 0x008bb5e8, 0x008bb6e8, 0x008bb7e6, 0x008bb8e4, 0x008bb9e4,
+    0x008bbae4, 0x008bbbe4, 0x008bbbe6, 0x008bbee4, 0x008bbee5, 0x008c80e8,
+    0x008c81e7, 0x008c81e8, 0x008c82e8, 0x008c83e3, 0x008c83e8, 0x008c85e6,
+    0x008c85e7, 0x008c86e5, 0x008c87e5, 0x008c87e9, 0x008c88e8, 0x008c89e7,
+    0x008c8ee5, 0x008c8ee6, 0x008c8fe5, 0x008c8fe8, 0x008c90e5, 0x008c90e8,
+    0x008c92e5, 0x008c95e6, 0x008c95e7, 0x008c98e6, 0x008c99e7, 0x008c99e9,
+    0x008c9be9, 0x008ca0e7, 0x008ca1e5, 0x008ca1e6, 0x008ca1e8, 0x008ca2e7,
+    0x008caae9, 0x008cabe5, 0x008cade6, 0x008caee5, 0x008cafe5, 0x008cb2e8,
+    0x008cb3e6, 0x008cb5e8, 0x008cb6e6, 0x008cb7e8, 0x008cb8e5, 0x008cb9e4,
+    0x008cbae4, 0x008cbcef, 0x008cbfe5, 0x008d80e5, 0x008d80e8, 0x008d81e9,
+    0x008d82e5, 0x008d83e3, 0x008d85e5, 0x008d85e9, 0x008d86e5, 0x008d87e9,
+    0x008d88e8, 0x008d89e5, 0x008d89e6, 0x008d8be6, 0x008d8be8, 0x008d8fe5,
+    0x008d8fe7, 0x008d90e5, 0x008d90e8, 0x008d93e5, 0x008d93e6, 0x008d99e9,
+    0x008d9ce6, 0x008d9ce9, 0x008d9ee8, 0x008da0e7, 0x008da1e8, 0x008da2e7,
+    0x008da3e6, 0x008da4e5, 0x008da4e6, 0x008da7e7, 0x008da8e7, 0x008dafe6,
+    0x008dafe8, 0x008db1e7, 0x008db8e4, 0x008dbbe4, 0x008dbbe7, 0x008dbce4,
+    0x008dbde4, 0x008dbee4, 0x008dbfe5, 0x008e80e6, 0x008e82e7, 0x008e83e3,
+    0x008e83e8, 0x008e83e9, 0x008e85e6, 0x008e87e9, 0x008e89e6, 0x008e8ce7,
+    0x008e8ce8, 0x008e8de5, 0x008e90e5, 0x008e90e8, 0x008e93e5, 0x008e98e6,
+    0x008e99e8, 0x008e9de6, 0x008e9ee7, 0x008e9fe5, 0x008ea2e7, 0x008ea3e9,
+    0x008ea8e7, 0x008eb5e6, 0x008eb8e4, 0x008eb9e4, 0x008ebae4, 0x008ebbe4,
+    0x008ebbe9, 0x008ebde4, 0x008ebee7, 0x008ebfe8, 0x008f80e9, 0x008f81e5,
+    0x008f83e3, 0x008f83e5, 0x008f84e6, 0x008f84e8, 0x008f87e5, 0x008f87e9,
+    0x008f88e6, 0x008f8be8, 0x008f8de5, 0x008f8de6, 0x008f8ee6, 0x008f8fe6,
+    0x008f90e6, 0x008f95e6, 0x008f96e7, 0x008f97e6, 0x008f97e8, 0x008f98e6,
+    0x008f9ae9, 0x008f9de5, 0x008f9de6, 0x008f9fe6, 0x008fa0e6, 0x008fa4e5,
+    0x008fa5e5, 0x008fa6e7, 0x008fade9, 0x008faee5, 0x008fafe6, 0x008fb0e5,
+    0x008fb0e6, 0x008fb1e5, 0x008fb5e8, 0x008fb8e8, 0x008fb9e4, 0x008fb9e9,
+    0x008fbae4, 0x008fbae5, 0x008fbbe7, 0x008fbce4, 0x008fbce5, 0x008fbce6,
+    0x008fbde4, 0x009080e8, 0x009080e9, 0x009081e6, 0x009083e3, 0x009085e8,
+    0x009088e6, 0x00908be6, 0x00908be7, 0x00908fe6, 0x009090e5, 0x009094e5,
+    0x009094e9, 0x009098e9, 0x009099e9, 0x00909ae9, 0x00909be7, 0x00909de5,
+    0x00909de6, 0x00909ee6, 0x00909fe6, 0x0090a1e6, 0x0090a4e8, 0x0090a4e9,
+    0x0090a7e5, 0x0090ade5, 0x0090b0e8, 0x0090b8e5, 0x0090b8e6, 0x0090b9e4,
+    0x0090bae6, 0x0090bce4, 0x0090bde7, 0x0090bde9, 0x0090bee5, 0x0090bee8,
+    0x0090bfe8, 0x009183e3, 0x009183e6, 0x009183e9, 0x009184e8, 0x009187e5,
+    0x009187e9, 0x009188e5, 0x009188e6, 0x009189e5, 0x009189e6, 0x00918ae6,
+    0x00918ce6, 0x00918de5, 0x00918fe5, 0x009190e5, 0x009192e6, 0x009193e5,
+    0x009195e6, 0x009196e6, 0x009196e7, 0x009198e8, 0x009199e8, 0x00919ae6,
+    0x00919be7, 0x00919de5, 0x00919de6, 0x0091a0e6, 0x0091a1e5, 0x0091a1e6,
+    0x0091a2e7, 0x0091a2e9, 0x0091a5e5, 0x0091a7e5, 0x0091a7e7, 0x0091aae9,
+    0x0091ace7, 0x0091ade7, 0x0091afe8, 0x0091b0e5, 0x0091b0e6, 0x0091b1e5,
+    0x0091b5e6, 0x0091b7e8, 0x0091b8e4, 0x0091bae4, 0x0091bbe6, 0x0091bbe9,
+    0x0091bce4, 0x0091bde7, 0x0091bee8, 0x0091bfe8, 0x009280e5, 0x009280e6,
+    0x009280e9, 0x009281e6, 0x009282e7, 0x009283e3, 0x009284e5, 0x009285e9,
+    0x009286e5, 0x009286e9, 0x009287e6, 0x009288e5, 0x009288e6, 0x009288e8,
+    0x00928ae6, 0x00928ae8, 0x00928be5, 0x00928be6, 0x00928de8, 0x00928ee6,
+    0x00928fe6, 0x009292e6, 0x009297e7, 0x009299e6, 0x00929be7, 0x00929de9,
+    0x0092a3e6, 0x0092a7e7, 0x0092a7e8, 0x0092aae5, 0x0092ade7, 0x0092afe5,
+    0x0092afe6, 0x0092b2e7, 0x0092b4e6, 0x0092bae4, 0x0092bbe7, 0x0092bde5,
+    0x0092bee5, 0x009381e9, 0x009382e9, 0x009383e3, 0x009389e6, 0x00938ae6,
+    0x00938be6, 0x009390e5, 0x009392e9, 0x009397e5, 0x009398e6, 0x009399e6,
+    0x00939ae8, 0x00939ce8, 0x00939fe6, 0x0093a2e5, 0x0093a7e5, 0x0093abe9,
+    0x0093afe5, 0x0093b0e8, 0x0093b5e6, 0x0093b8e4, 0x0093bae5, 0x0093bbe4,
+    0x0093bbe7, 0x0093bce5, 0x0093bce7, 0x0093bce9, 0x0093bde4, 0x0093bde5,
+    0x0093bee8, 0x009480e9, 0x009481e8, 0x009482e6, 0x009483e3, 0x009485e5,
+    0x009485e8, 0x009486e7, 0x009489e6, 0x00948be6, 0x00948fe5, 0x009491e6,
+    0x009498e9, 0x00949ae9, 0x00949fe6, 0x0094a0e7, 0x0094a1e5, 0x0094a1e8,
+    0x0094a5e5, 0x0094a7e5, 0x0094ace7, 0x0094ade5, 0x0094ade7, 0x0094ade9,
+    0x0094afe6, 0x0094b0e5, 0x0094b0e6, 0x0094b5e8, 0x0094b8e4, 0x0094b8e6,
+    0x0094b9e4, 0x0094bae4, 0x0094bae5, 0x0094bbe4, 0x0094bce6, 0x0094bfe7,
+    0x0094bfe8, 0x009580e6, 0x009580e8, 0x009582e7, 0x009583e3, 0x009585e6,
+    0x009587e7, 0x00958ae6, 0x00958de5, 0x00958de6, 0x009592e5, 0x009592e6,
+    0x009597e7, 0x009599e6, 0x009599e9, 0x00959ae8, 0x00959be9, 0x00959ee6,
+    0x0095a3e6, 0x0095a3e8, 0x0095a4e5, 0x0095ade5, 0x0095afe6, 0x0095afe8,
+    0x0095b1e5, 0x0095b3e6, 0x0095b8e5, 0x0095b9e5, 0x0095bae4, 0x0095bae5,
+    0x0095bbe7, 0x0095bce5, 0x0095bde4, 0x0095bde5, 0x0095bde7, 0x009683e3,
+    0x009683e8, 0x009684e8, 0x009688e6, 0x009689e5, 0x00968ae6, 0x00968be6,
+    0x00968ce5, 0x00968ce6, 0x00968de5, 0x00968fe5, 0x00969ae6, 0x00969be7,
+    0x0096a0e6, 0x0096a0e7, 0x0096a2e8, 0x0096a4e5, 0x0096a5e5, 0x0096a5e7,
+    0x0096a6e9, 0x0096abe7, 0x0096ade7, 0x0096aee6, 0x0096b0e5, 0x0096b3e7,
+    0x0096b4e5, 0x0096b5e8, 0x0096b8e4, 0x0096b9e6, 0x0096bbe4, 0x0096bce7,
+    0x0096bee8, 0x009780e8, 0x009781e9, 0x009783e3, 0x009788e5, 0x00978ae6,
+    0x00978be7, 0x00978be8, 0x00978ce5, 0x00978de5, 0x00978fe5, 0x009790e5,
+    0x009791e8, 0x009793e5, 0x009796e6, 0x009796e7, 0x009797e6, 0x00979ae6,
+    0x00979be7, 0x00979ce6, 0x00979de5, 0x00979ee6, 0x0097a1e8, 0x0097a2e7,
+    0x0097a2e9, 0x0097a5e5, 0x0097a9e7, 0x0097aae7, 0x0097aae9, 0x0097ade5,
+    0x0097aee5, 0x0097aee7, 0x0097afe8, 0x0097b1e6, 0x0097b2e5, 0x0097b2e7,
+    0x0097b4e6, 0x0097b8e6, 0x0097bae5, 0x0097bbe4, 0x0097bce4, 0x0097bce5,
+    0x0097bde7, 0x0097bee5, 0x0097bfe4, 0x0097bfe5, 0x009883e3, 0x009888e5,
+    0x009888e6, 0x009889e6, 0x009889e8, 0x00988ae6, 0x00988ee5, 0x00988ee6,
+    0x00988fe5, 0x009891e5, 0x009891e6, 0x009894e7, 0x009896e5, 0x00989be7,
+    0x00989ce8, 0x0098a1e5, 0x0098a2e9, 0x0098a3e9, 0x0098a7e7, 0x0098a8e5,
+    0x0098a9e6, 0x0098abe9, 0x0098ade5, 0x0098aee5, 0x0098b0e5, 0x0098b2e7,
+    0x0098b7e6, 0x0098b8e4, 0x0098b8e5, 0x0098b9e4, 0x0098b9e6, 0x0098bbe4,
+    0x0098bbe7, 0x0098bbe9, 0x0098bce4, 0x0098bce7, 0x0098bfe5, 0x0098bfe8,
+    0x009980e5, 0x009983e3, 0x009986e5, 0x009986e7, 0x009988e5, 0x009989e7,
+    0x00998ce5, 0x00998fe5, 0x009992e8, 0x009992e9, 0x009994e9, 0x009995e6,
+    0x009995e7, 0x009996e6, 0x00999ae9, 0x00999be8, 0x00999de8, 0x00999de9,
+    0x0099a2e5, 0x0099a3e8, 0x0099a6e5, 0x0099a6e9, 0x0099a9e6, 0x0099abe7,
+    0x0099ade5, 0x0099aee5, 0x0099b2e6, 0x0099b5e6, 0x0099b8e4, 0x0099b9e4,
+    0x0099bae5, 0x0099bbe4, 0x0099bbe7, 0x0099bce4, 0x0099bde4, 0x0099bee9,
+    0x0099bfe5, 0x0099bfe8, 0x009a80e9, 0x009a81e5, 0x009a81e8, 0x009a82e8,
+    0x009a83e3, 0x009a83e5, 0x009a83e8, 0x009a84e6, 0x009a84e8, 0x009a85e5,
+    0x009a88e5, 0x009a88e6, 0x009a8ae6, 0x009a8de5, 0x009a8ee5, 0x009a94e7,
+    0x009a99e6, 0x009a99e8, 0x009a9de5, 0x009a9ee6, 0x009aa3e6, 0x009aa4e5,
+    0x009aa5e6, 0x009aa9e5, 0x009aaee5, 0x009aafe8, 0x009ab0e5, 0x009ab5e8,
+    0x009ab8e4, 0x009abae4, 0x009abbe6, 0x009abce4, 0x009abde7, 0x009abee7,
+    0x009b83e3, 0x009b83e7, 0x009b86e5, 0x009b88e5, 0x009b89e7, 0x009b8ae5,
+    0x009b8ae6, 0x009b8be6, 0x009b8ce7, 0x009b8ee7, 0x009b8fe5, 0x009b90e5,
+    0x009b91e8, 0x009b97e7, 0x009b98e5, 0x009b9be5, 0x009b9be7, 0x009b9be8,
+    0x009b9ce6, 0x009b9de5, 0x009b9de7, 0x009b9fe7, 0x009bace7, 0x009bafe6,
+    0x009bb2e5, 0x009bb3e6, 0x009bb4e6, 0x009bb5e8, 0x009bb6e6, 0x009bb8e4,
+    0x009bbae4, 0x009bbde4, 0x009bbee4, 0x009bbee8, 0x009bbfe8, 0x009c80e2,
+    0x009c80e6, 0x009c81e5, 0x009c83e3, 0x009c83e6, 0x009c83e8, 0x009c86e5,
+    0x009c86e8, 0x009c8be6, 0x009c8ce7, 0x009c8de5, 0x009c8fe8, 0x009c90e6,
+    0x009c92e8, 0x009c93e7, 0x009c93e9, 0x009c94e7, 0x009c95e7, 0x009c95e9,
+    0x009c96e5, 0x009c96e6, 0x009c9ae9, 0x009c9ce8, 0x009c9ce9, 0x009c9de6,
+    0x009c9ee6, 0x009c9fe6, 0x009ca2e9, 0x009ca4e5, 0x009ca7e5, 0x009ca8e5,
+    0x009caee5, 0x009cb0e8, 0x009cb2e9, 0x009cb8e4, 0x009cbae5, 0x009cbae6,
+    0x009cbbe7, 0x009cbde4, 0x009cbde6, 0x009cbfe8, 0x009d80e2, 0x009d80e6,
+    0x009d80e9, 0x009d82e8, 0x009d83e3, 0x009d86e8, 0x009d87e5, 0x009d88e5,
+    0x009d8ae5, 0x009d8ae8, 0x009d90e8, 0x009d93e8, 0x009d93e9, 0x009d96e5,
+    0x009d9ce6, 0x009d9de5, 0x009d9ee6, 0x009da1e7, 0x009da2e9, 0x009da5e7,
+    0x009daae7, 0x009dade5, 0x009daee5, 0x009dafe8, 0x009db0e5, 0x009db4e8,
+    0x009db7e5, 0x009db7e8, 0x009db8e4, 0x009db8e5, 0x009db9e4, 0x009dbbe7,
+    0x009dbce7, 0x009dbee4, 0x009dbfe4, 0x009dbfe8, 0x009e83e3, 0x009e83e8,
+    0x009e88e8, 0x009e8ae5, 0x009e8de6, 0x009e90e5, 0x009e90e6, 0x009e91e7,
+    0x009e92e6, 0x009e9be5, 0x009e9ce9, 0x009e9de9, 0x009ea1e5, 0x009ea2e5,
+    0x009ea3e9, 0x009ea5e7, 0x009eabe7, 0x009eaee5, 0x009eafe8, 0x009eb1e5,
+    0x009eb4e6, 0x009eb5e8, 0x009eb7e5, 0x009ebae5, 0x009ebce4, 0x009ebee7,
+    0x009ebee8, 0x009ebfe8, 0x009f80e5, 0x009f80e9, 0x009f82e6, 0x009f83e3,
+    0x009f83e6, 0x009f83e7, 0x009f84e6, 0x009f86e7, 0x009f88e8, 0x009f8ae5,
+    0x009f8be6, 0x009f8de6, 0x009f8ee5, 0x009f90e5, 0x009f92e9, 0x009f93e5,
+    0x009f94e7, 0x009f98e6, 0x009f98e9, 0x009f9be7, 0x009f9ce5, 0x009f9ce6,
+    0x009f9ce7, 0x009f9de5, 0x009f9de6, 0x009f9fe5, 0x009fa3e9, 0x009fa4e5,
+    0x009fa7e7, 0x009fabe7, 0x009fade5, 0x009fafe5, 0x009fb1e6, 0x009fb2e6,
+    0x009fb3e7, 0x009fb4e8, 0x009fb6e8, 0x009fb7e8, 0x009fb8e9, 0x009fb9e4,
+    0x009fbae5, 0x009fbbe7, 0x009fbce4, 0x009fbce5, 0x009fbcef, 0x009fbee8,
+    0x009fbee9, 0x009fbfe8, 0x00a080e9, 0x00a082e6, 0x00a082e8, 0x00a083e3,
+    0x00a083e6, 0x00a086e5, 0x00a087e5, 0x00a08ae5, 0x00a08be7, 0x00a08ce5,
+    0x00a08de5, 0x00a08ee6, 0x00a08fe5, 0x00a08fe7, 0x00a092e9, 0x00a097e6,
+    0x00a098e6, 0x00a09be5, 0x00a09ce7, 0x00a09de8, 0x00a09de9, 0x00a0a2e9,
+    0x00a0abe7, 0x00a0ace6, 0x00a0b1e5, 0x00a0b1e6, 0x00a0b4e7, 0x00a0b5e8,
+    0x00a0b9e4, 0x00a0bae7, 0x00a0bce4, 0x00a0bce5, 0x00a0bce6, 0x00a0bce7,
+    0x00a0bce9, 0x00a0bde4, 0x00a0bfe5, 0x00a0bfe7, 0x00a180e5, 0x00a182e3,
+    0x00a182e8, 0x00a183e3, 0x00a183e8, 0x00a187e5, 0x00a189e7, 0x00a18ae5,
+    0x00a18ce6, 0x00a18de5, 0x00a18de8, 0x00a18fe6, 0x00a191e8, 0x00a194e8,
+    0x00a194e9, 0x00a195e5, 0x00a199e9, 0x00a19ce8, 0x00a19de5, 0x00a19de6,
+    0x00a19de7, 0x00a1a0e5, 0x00a1a0e6, 0x00a1a1e8, 0x00a1a8e6, 0x00a1a9e6,
+    0x00a1ace6, 0x00a1aee5, 0x00a1aee7, 0x00a1aee8, 0x00a1b1e6, 0x00a1b1e8,
+    0x00a1b2e6, 0x00a1b3e5, 0x00a1b3e6, 0x00a1b4e8, 0x00a1b7e5, 0x00a1b7e6,
+    0x00a1b8e6, 0x00a1b8e9, 0x00a1b9e4, 0x00a1bae4, 0x00a1bbe6, 0x00a1bee5,
+    0x00a1bfe4, 0x00a280e9, 0x00a281e6, 0x00a282e3, 0x00a282e8, 0x00a283e3,
+    0x00a285e6, 0x00a289e7, 0x00a28ae6, 0x00a28be6, 0x00a28de5, 0x00a28de6,
+    0x00a28ee5, 0x00a28ee6, 0x00a291e5, 0x00a292e9, 0x00a293e7, 0x00a295e6,
+    0x00a297e6, 0x00a299e9, 0x00a29be5, 0x00a29de9, 0x00a29ee6, 0x00a2a2e6,
+    0x00a2ace6, 0x00a2ade6, 0x00a2aee5, 0x00a2aee8, 0x00a2afe8, 0x00a2b0e6,
+    0x00a2b0e8, 0x00a2b3e6, 0x00a2b4e7, 0x00a2b4e8, 0x00a2b5e8, 0x00a2b7e5,
+    0x00a2b8e4, 0x00a2b8e8, 0x00a2bae6, 0x00a2bae7, 0x00a2bde5, 0x00a2bde7,
+    0x00a381e9, 0x00a382e3, 0x00a382e6, 0x00a382e9, 0x00a383e3, 0x00a384e6,
+    0x00a387e8, 0x00a389e6, 0x00a38ae5, 0x00a38ce6, 0x00a38de8, 0x00a38fe5,
+    0x00a393e7, 0x00a395e6, 0x00a39ce5, 0x00a39de7, 0x00a39ee6, 0x00a39fe7,
+    0x00a3a1e8, 0x00a3a7e8, 0x00a3ace6, 0x00a3ade5, 0x00a3ade6, 0x00a3aee5,
+    0x00a3b4e8, 0x00a3b6e8, 0x00a3b8e6, 0x00a3b8e9, 0x00a3bbe4, 0x00a3bbe7,
+    0x00a3bee8, 0x00a482e3, 0x00a482e8, 0x00a483e3, 0x00a483e7, 0x00a484e6,
+    0x00a485e7, 0x00a487e5, 0x00a488e5, 0x00a48ae6, 0x00a48be5, 0x00a48ce6,
+    0x00a48fe5, 0x00a492e6, 0x00a494e5, 0x00a494e9, 0x00a496e6, 0x00a497e8,
+    0x00a498e7, 0x00a499e9, 0x00a4a0e5, 0x00a4a2e9, 0x00a4a3e5, 0x00a4a3e8,
+    0x00a4aae9, 0x00a4ade5, 0x00a4ade6, 0x00a4aee5, 0x00a4aee8, 0x00a4b0e5,
+    0x00a4b1e6, 0x00a4b2e9, 0x00a4b4e8, 0x00a4b5e8, 0x00a4b8e4, 0x00a4b9e9,
+    0x00a4bae4, 0x00a4bae7, 0x00a4bbe4, 0x00a4bbe6, 0x00a4bce4, 0x00a4bee7,
+    0x00a580e6, 0x00a581e5, 0x00a581e9, 0x00a582e3, 0x00a582e8, 0x00a583e3,
+    0x00a585e5, 0x00a587e7, 0x00a589e5, 0x00a58ae6, 0x00a58be6, 0x00a58be8,
+    0x00a58ce6, 0x00a58ee6, 0x00a58fe5, 0x00a590e8, 0x00a592e9, 0x00a593e5,
+    0x00a595e5, 0x00a595e7, 0x00a596e6, 0x00a597e6, 0x00a598e6, 0x00a59de6,
+    0x00a59fe6, 0x00a59fe7, 0x00a5a1e6, 0x00a5a1e8, 0x00a5a5e5, 0x00a5a5e7,
+    0x00a5a5e9, 0x00a5a6e5, 0x00a5abe7, 0x00a5ade6, 0x00a5afe8, 0x00a5b1e5,
+    0x00a5b3e6, 0x00a5b4e6, 0x00a5b4e8, 0x00a5b7e5, 0x00a5b8e4, 0x00a5bbe4,
+    0x00a5bbe6, 0x00a5bce5, 0x00a680e5, 0x00a682e3, 0x00a682e6, 0x00a682e9,
+    0x00a683e3, 0x00a683e7, 0x00a684e7, 0x00a68ae8, 0x00a68be6, 0x00a68be8,
+    0x00a68ee5, 0x00a68fe5, 0x00a690e5, 0x00a693e5, 0x00a693e6, 0x00a693e7,
+    0x00a694e9, 0x00a695e5, 0x00a695e6, 0x00a697e6, 0x00a698e7, 0x00a69de5,
+    0x00a6a1e6, 0x00a6a2e6, 0x00a6a7e7, 0x00a6a7e8, 0x00a6ace7, 0x00a6ade5,
+    0x00a6ade6, 0x00a6ade8, 0x00a6afe8, 0x00a6b0e8, 0x00a6b4e8, 0x00a6b5e6,
+    0x00a6b6e6, 0x00a6b7e5, 0x00a6b8e5, 0x00a6b8e9, 0x00a6b9e4, 0x00a6bae4,
+    0x00a6bae5, 0x00a6bae7, 0x00a6bae9, 0x00a6bce4, 0x00a6bce5, 0x00a6bde8,
+    0x00a6bee4, 0x00a780e6, 0x00a782e3, 0x00a783e3, 0x00a783e5, 0x00a783e6,
+    0x00a783e7, 0x00a784e6, 0x00a785e6, 0x00a785e7, 0x00a789e5, 0x00a789e6,
+    0x00a789e7, 0x00a78de5, 0x00a78de6, 0x00a78ee6, 0x00a790e5, 0x00a790e8,
+    0x00a797e6, 0x00a79ee7, 0x00a7a2e7, 0x00a7a4e5, 0x00a7ace6, 0x00a7ade6,
+    0x00a7b0e6, 0x00a7b4e7, 0x00a7b4e8, 0x00a7b7e5, 0x00a7b8e4, 0x00a7bae4,
+    0x00a7bae5, 0x00a7bae7, 0x00a7bbe7, 0x00a7bee4, 0x00a7bfe5, 0x00a880e6,
+    0x00a881e6, 0x00a882e3, 0x00a882e5, 0x00a882e6, 0x00a883e3, 0x00a883e6,
+    0x00a883e9, 0x00a885e5, 0x00a885e6, 0x00a886e8, 0x00a88ae5, 0x00a88be6,
+    0x00a88ce6, 0x00a88ee5, 0x00a88ee6, 0x00a890e5, 0x00a890e8, 0x00a891e5,
+    0x00a893e5, 0x00a894e7, 0x00a897e6, 0x00a897e9, 0x00a898e6, 0x00a899e5,
+    0x00a899e6, 0x00a89be9, 0x00a89ce5, 0x00a89ce6, 0x00a89ce7, 0x00a89de6,
+    0x00a8a1e8, 0x00a8a2e5, 0x00a8a2e6, 0x00a8a3e7, 0x00a8a5e7, 0x00a8a6e5,
+    0x00a8a7e5, 0x00a8aae9, 0x00a8aee8, 0x00a8b0e6, 0x00a8b3e6, 0x00a8b4e8,
+    0x00a8b6e6, 0x00a8b7e5, 0x00a8b7e8, 0x00a8bbe6, 0x00a8bde8, 0x00a8bee8,
+    0x00a981e6, 0x00a982e3, 0x00a982e8, 0x00a983e3, 0x00a983e6, 0x00a988e5,
+    0x00a989e5, 0x00a989e6, 0x00a989e7, 0x00a98ae5, 0x00a98be6, 0x00a98ce7,
+    0x00a98ee6, 0x00a98ee7, 0x00a991e6, 0x00a992e9, 0x00a993e5, 0x00a994e7,
+    0x00a997e6, 0x00a999e9, 0x00a99de9, 0x00a99fe7, 0x00a99fe9, 0x00a9a1e6,
+    0x00a9a4e5, 0x00a9abe5, 0x00a9ade5, 0x00a9aee8, 0x00a9b2e5, 0x00a9b4e5,
+    0x00a9b4e8, 0x00a9b5e6, 0x00a9b7e5, 0x00a9b8e6, 0x00a9b8e8, 0x00a9bae4,
+    0x00a9bbe6, 0x00a9bbe7, 0x00a9bce7, 0x00a9bde4, 0x00a9bde5, 0x00a9bde7,
+    0x00a9bee8, 0x00a9bfe4, 0x00aa80e6, 0x00aa81e8, 0x00aa82e3, 0x00aa82e8,
+    0x00aa83e3, 0x00aa87e8, 0x00aa88e6, 0x00aa88e7, 0x00aa88e8, 0x00aa89e5,
+    0x00aa8ae5, 0x00aa8ce6, 0x00aa8ce7, 0x00aa8ee6, 0x00aa8fe5, 0x00aa93e5,
+    0x00aa95e7, 0x00aa97e9, 0x00aa99e5, 0x00aa99e9, 0x00aa9be9, 0x00aa9ce6,
+    0x00aa9ee6, 0x00aa9ee7, 0x00aaa0e5, 0x00aaa0e6, 0x00aaa4e5, 0x00aaa8e6,
+    0x00aaade6, 0x00aaaee5, 0x00aab1e6, 0x00aab1e8, 0x00aab2e7, 0x00aab3e6,
+    0x00aab4e6, 0x00aab4e8, 0x00aab5e6, 0x00aab8e4, 0x00aab8e8, 0x00aabae6,
+    0x00aabae7, 0x00aabbe4, 0x00aabbe7, 0x00aabce4, 0x00aabde7, 0x00aabee5,
+    0x00aabfe8, 0x00ab81e7, 0x00ab82e3, 0x00ab83e3, 0x00ab85e5, 0x00ab88e5,
+    0x00ab89e6, 0x00ab8ae5, 0x00ab8ae6, 0x00ab8ce7, 0x00ab8ce8, 0x00ab8de5,
+    0x00ab8ee7, 0x00ab8ee8, 0x00ab8fe5, 0x00ab90e5, 0x00ab91e8, 0x00ab96e7,
+    0x00ab99e8, 0x00ab9ce6, 0x00ab9ee5, 0x00ab9ee6, 0x00aba1e5, 0x00aba1e7,
+    0x00aba1e8, 0x00aba2e8, 0x00aba3e5, 0x00aba4e5, 0x00abaee5, 0x00abafe6,
+    0x00abb1e8, 0x00abb2e6, 0x00abb4e7, 0x00abb4e8, 0x00abb5e8, 0x00abbae4,
+    0x00abbae8, 0x00abbce6, 0x00abbfe5, 0x00abbfe8, 0x00ac82e3, 0x00ac82e5,
+    0x00ac82e6, 0x00ac83e3, 0x00ac85e5, 0x00ac85e9, 0x00ac86e5, 0x00ac86e7,
+    0x00ac88e7, 0x00ac88e8, 0x00ac89e6, 0x00ac8ae6, 0x00ac8ae7, 0x00ac8ae8,
+    0x00ac8be6, 0x00ac8be7, 0x00ac8fe5, 0x00ac90e5, 0x00ac90e6, 0x00ac91e8,
+    0x00ac92e5, 0x00ac93e8, 0x00ac94e8, 0x00ac95e6, 0x00ac9ce6, 0x00ac9ee7,
+    0x00aca1e7, 0x00aca1e8, 0x00aca9e9, 0x00acace7, 0x00acade8, 0x00acbae4,
+    0x00acbae7, 0x00acbbe4, 0x00acbde8, 0x00ad81e6, 0x00ad81e7, 0x00ad81e9,
+    0x00ad82e3, 0x00ad82e7, 0x00ad83e3, 0x00ad83e7, 0x00ad83e9, 0x00ad85e5,
+    0x00ad87e5, 0x00ad87e8, 0x00ad89e6, 0x00ad8be7, 0x00ad8fe5, 0x00ad8fe6,
+    0x00ad8fe7, 0x00ad90e6, 0x00ad92e6, 0x00ad93e5, 0x00ad96e6, 0x00ad97e9,
+    0x00ad9be5, 0x00ad9de6, 0x00ad9ee9, 0x00ad9fe7, 0x00ada2e8, 0x00ada5e9,
+    0x00adabe7, 0x00adaee7, 0x00adaee8, 0x00adafe8, 0x00adb2e5, 0x00adb4e8,
+    0x00adb8e4, 0x00adb8e5, 0x00adb8e9, 0x00adbae4, 0x00adbae5, 0x00adbbe7,
+    0x00adbde6, 0x00ae80e9, 0x00ae81e9, 0x00ae82e3, 0x00ae82e7, 0x00ae82e9,
+    0x00ae83e3, 0x00ae85e7, 0x00ae88e5, 0x00ae89e6, 0x00ae8be7, 0x00ae8ce7,
+    0x00ae8de6, 0x00ae8fe5, 0x00ae94e5, 0x00ae94e9, 0x00ae97e9, 0x00ae99e6,
+    0x00ae9ae7, 0x00ae9be7, 0x00ae9be8, 0x00ae9fe7, 0x00aea1e7, 0x00aea3e5,
+    0x00aea3e6, 0x00aea4e5, 0x00aea5e9, 0x00aeaee8, 0x00aeafe7, 0x00aeb0e6,
+    0x00aeb2e7, 0x00aeb4e8, 0x00aeb5e6, 0x00aeb7e5, 0x00aeb7e6, 0x00aeb8e5,
+    0x00aebae4, 0x00aebde6, 0x00aebde7, 0x00aebde8, 0x00aebee5, 0x00aebfe4,
+    0x00af81e6, 0x00af81e7, 0x00af82e3, 0x00af82e8, 0x00af83e3, 0x00af83e6,
+    0x00af86e5, 0x00af87e5, 0x00af89e5, 0x00af89e6, 0x00af89e8, 0x00af8ae7,
+    0x00af8ce6, 0x00af8de5, 0x00af8de8, 0x00af8ee7, 0x00af8fe5, 0x00af90e5,
+    0x00af94e5, 0x00af94e6, 0x00af96e6, 0x00af96e7, 0x00af96e8, 0x00af97e9,
+    0x00af98e6, 0x00af99e6, 0x00af9ae8, 0x00af9be7, 0x00af9ce6, 0x00af9de6,
+    0x00af9ee6, 0x00afa2e6, 0x00afa7e7, 0x00afabe7, 0x00afaee8, 0x00afafe8,
+    0x00afb0e6, 0x00afb4e7, 0x00afb4e8, 0x00afb7e8, 0x00afb8e6, 0x00afbae7,
+    0x00afbae8, 0x00afbce4, 0x00afbce5, 0x00afbde8, 0x00afbee4, 0x00b081e6,
+    0x00b081e7, 0x00b082e3, 0x00b084e7, 0x00b085e5, 0x00b085e6, 0x00b085e8,
+    0x00b086e5, 0x00b088e5, 0x00b088e8, 0x00b089e6, 0x00b089e8, 0x00b08de5,
+    0x00b08ee7, 0x00b08fe5, 0x00b094e7, 0x00b095e6, 0x00b096e6, 0x00b099e6,
+    0x00b09be5, 0x00b09be6, 0x00b09ce5, 0x00b09de6, 0x00b0a1e8, 0x00b0a2e6,
+    0x00b0a2e7, 0x00b0a3e5, 0x00b0a5e9, 0x00b0a7e7, 0x00b0a9e9, 0x00b0aee5,
+    0x00b0aee8, 0x00b0b3e5, 0x00b0b3e6, 0x00b0b5e8, 0x00b0b8e4, 0x00b0b9e4,
+    0x00b0b9e9, 0x00b0bbe4, 0x00b0bce4, 0x00b0bde8, 0x00b0bfe8, 0x00b182e3,
+    0x00b184e8, 0x00b185e5, 0x00b188e7, 0x00b188e8, 0x00b18ae5, 0x00b18ae6,
+    0x00b18ae8, 0x00b18be6, 0x00b18be7, 0x00b18be8, 0x00b18de5, 0x00b18ee8,
+    0x00b191e8, 0x00b192e5, 0x00b192e9, 0x00b194e5, 0x00b194e7, 0x00b197e6,
+    0x00b198e5, 0x00b19ae7, 0x00b19ce6, 0x00b19fe6, 0x00b1a2e7, 0x00b1a4e5,
+    0x00b1a5e9, 0x00b1a8e5, 0x00b1a9e9, 0x00b1aee7, 0x00b1afe8, 0x00b1b0e5,
+    0x00b1b0e8, 0x00b1b1e5, 0x00b1b7e5, 0x00b1b7e6, 0x00b1b9e4, 0x00b1bae7,
+    0x00b1bce5, 0x00b1bde5, 0x00b1bee8, 0x00b1bfe4, 0x00b282e3, 0x00b282e5,
+    0x00b282e6, 0x00b282e8, 0x00b283e3, 0x00b286e5, 0x00b289e5, 0x00b289e7,
+    0x00b289e8, 0x00b28ae5, 0x00b28ee7, 0x00b28ee8, 0x00b28fe5, 0x00b28fe8,
+    0x00b292e8, 0x00b293e5, 0x00b294e7, 0x00b295e6, 0x00b296e7, 0x00b297e9,
+    0x00b298e9, 0x00b29be6, 0x00b29be7, 0x00b29ce9, 0x00b2a5e9, 0x00b2ace6,
+    0x00b2aee8, 0x00b2b4e6, 0x00b2b6e6, 0x00b2b7e5, 0x00b2b8e4, 0x00b2b9e5,
+    0x00b2b9e8, 0x00b2bae4, 0x00b2bae7, 0x00b2bae8, 0x00b2bbe4, 0x00b2bde7,
+    0x00b380e8, 0x00b382e3, 0x00b383e3, 0x00b383e6, 0x00b383e8, 0x00b385e5,
+    0x00b386e5, 0x00b387e5, 0x00b387e8, 0x00b389e8, 0x00b38ae5, 0x00b38ae8,
+    0x00b38be6, 0x00b38de5, 0x00b38fe5, 0x00b391e5, 0x00b392e5, 0x00b394e7,
+    0x00b398e9, 0x00b39fe6, 0x00b39fe7, 0x00b39fe9, 0x00b3a2e7, 0x00b3a3e5,
+    0x00b3a5e5, 0x00b3a8e7, 0x00b3a9e9, 0x00b3aae5, 0x00b3aee5, 0x00b3b1e7,
+    0x00b3b2e5, 0x00b3b2e6, 0x00b3b3e6, 0x00b3b6e8, 0x00b3b7e8, 0x00b3b9e4,
+    0x00b3b9e5, 0x00b3bae7, 0x00b3bbe7, 0x00b3bde4, 0x00b3bee6, 0x00b482e3,
+    0x00b483e3, 0x00b485e5, 0x00b487e8, 0x00b488e6, 0x00b489e9, 0x00b48ce7,
+    0x00b48de5, 0x00b48fe6, 0x00b490e5, 0x00b490e7, 0x00b495e6, 0x00b495e8,
+    0x00b497e9, 0x00b498e5, 0x00b498e9, 0x00b499e6, 0x00b49ae6, 0x00b49be5,
+    0x00b49be6, 0x00b49be7, 0x00b49ce6, 0x00b49de8, 0x00b49fe6, 0x00b4a0e7,
+    0x00b4a4e5, 0x00b4a5e5, 0x00b4a9e5, 0x00b4a9e7, 0x00b4a9e9, 0x00b4aee5,
+    0x00b4afe8, 0x00b4b0e6, 0x00b4b4e8, 0x00b4b5e6, 0x00b4b5e8, 0x00b4b7e5,
+    0x00b4b8e4, 0x00b4b8e6, 0x00b4b9e5, 0x00b4bbe6, 0x00b4bbe7, 0x00b4bce4,
+    0x00b4bde8, 0x00b581e7, 0x00b581e9, 0x00b582e3, 0x00b583e5, 0x00b585e5,
+    0x00b586e5, 0x00b589e7, 0x00b58ae6, 0x00b58de5, 0x00b590e5, 0x00b591e5,
+    0x00b591e8, 0x00b594e7, 0x00b598e9, 0x00b599e9, 0x00b59ce6, 0x00b59fe9,
+    0x00b5a0e5, 0x00b5a1e9, 0x00b5a3e6, 0x00b5ade5, 0x00b5aee6, 0x00b5b4e8,
+    0x00b5b5e8, 0x00b5b7e8, 0x00b5bae7, 0x00b5bbe7, 0x00b5bee4, 0x00b5bfe5,
+    0x00b681e5, 0x00b681e6, 0x00b681e7, 0x00b682e3, 0x00b683e8, 0x00b684e7,
+    0x00b685e5, 0x00b686e5, 0x00b687e5, 0x00b688e5, 0x00b688e7, 0x00b689e6,
+    0x00b68ae7, 0x00b68ce8, 0x00b68fe5, 0x00b693e7, 0x00b693e9, 0x00b694e6,
+    0x00b697e6, 0x00b698e9, 0x00b699e6, 0x00b699e9, 0x00b69ae9, 0x00b69be9,
+    0x00b69de8, 0x00b69ee6, 0x00b6a1e6, 0x00b6a1e9, 0x00b6a3e5, 0x00b6a5e5,
+    0x00b6a5e9, 0x00b6a8e5, 0x00b6a9e5, 0x00b6a9e7, 0x00b6a9e9, 0x00b6aee5,
+    0x00b6b5e8, 0x00b6b9e5, 0x00b6bae6, 0x00b6bbe4, 0x00b6bbe5, 0x00b781e5,
+    0x00b782e3, 0x00b785e5, 0x00b785e9, 0x00b786e5, 0x00b788e5, 0x00b788e6,
+    0x00b788e7, 0x00b78de5, 0x00b78de6, 0x00b78de8, 0x00b78ee8, 0x00b78fe5,
+    0x00b793e7, 0x00b794e7, 0x00b796e5, 0x00b797e9, 0x00b799e9, 0x00b79ae5,
+    0x00b79be9, 0x00b7a0e6, 0x00b7a1e9, 0x00b7a3e7, 0x00b7a4e5, 0x00b7a9e7,
+    0x00b7afe8, 0x00b7b0e8, 0x00b7b5e6, 0x00b7b5e8, 0x00b7b7e5, 0x00b7b7e6,
+    0x00b7bae5, 0x00b7bae7, 0x00b7bbe4, 0x00b7bbe5, 0x00b7bee5, 0x00b7bfe8,
+    0x00b880e8, 0x00b880e9, 0x00b882e3, 0x00b882e7, 0x00b883e8, 0x00b884e8,
+    0x00b885e5, 0x00b885e9, 0x00b888e5, 0x00b888e7, 0x00b88de5, 0x00b88fe5,
+    0x00b890e5, 0x00b891e6, 0x00b892e5, 0x00b892e8, 0x00b89be7, 0x00b89ce9,
+    0x00b8a0e6, 0x00b8a0e7, 0x00b8a3e8, 0x00b8a4e5, 0x00b8a5e7, 0x00b8aee8,
+    0x00b8afe5, 0x00b8afe8, 0x00b8b0e5, 0x00b8b0e6, 0x00b8b2e5, 0x00b8b2e6,
+    0x00b8b2e9, 0x00b8b4e8, 0x00b8b5e6, 0x00b8b8e4, 0x00b8b8e5, 0x00b8b8e6,
+    0x00b8b9e5, 0x00b8bae7, 0x00b8bbe7, 0x00b8bce4, 0x00b8bce7, 0x00b982e3,
+    0x00b982e7, 0x00b983e6, 0x00b985e5, 0x00b985e8, 0x00b987e5, 0x00b988e5,
+    0x00b988e7, 0x00b988e8, 0x00b989e6, 0x00b989e7, 0x00b98ae6, 0x00b98ae7,
+    0x00b98be8, 0x00b98ce5, 0x00b98fe5, 0x00b990e5, 0x00b994e6, 0x00b996e6,
+    0x00b997e9, 0x00b999e8, 0x00b99be6, 0x00b99fe5, 0x00b99fe8, 0x00b9a0e6,
+    0x00b9a1e9, 0x00b9a3e8, 0x00b9a4e5, 0x00b9a5e5, 0x00b9a6e5, 0x00b9abe7,
+    0x00b9ade7, 0x00b9aee5, 0x00b9afe5, 0x00b9b1e8, 0x00b9b2e6, 0x00b9b4e8,
+    0x00b9b7e6, 0x00b9b8e4, 0x00b9bae7, 0x00b9bce5, 0x00b9bde5, 0x00b9bee8,
+    0x00b9bfe8, 0x00ba80e5, 0x00ba82e3, 0x00ba82e8, 0x00ba85e8, 0x00ba87e5,
+    0x00ba88e5, 0x00ba89e7, 0x00ba89e8, 0x00ba8ce5, 0x00ba8ce6, 0x00ba90e6,
+    0x00ba93e9, 0x00ba97e6, 0x00ba99e6, 0x00ba9be5, 0x00ba9ce5, 0x00ba9ce6,
+    0x00ba9ee8, 0x00ba9fe5, 0x00baa1e9, 0x00baa4e5, 0x00baa4e7, 0x00baa9e7,
+    0x00baace6, 0x00baaee8, 0x00baafe5, 0x00baafe8, 0x00bab0e5, 0x00bab4e8,
+    0x00bab8e4, 0x00babae4, 0x00babae7, 0x00babae8, 0x00babbe5, 0x00babce5,
+    0x00babce7, 0x00babfe4, 0x00bb80e6, 0x00bb80e9, 0x00bb82e3, 0x00bb82e5,
+    0x00bb82e9, 0x00bb83e3, 0x00bb85e5, 0x00bb86e5, 0x00bb87e5, 0x00bb88e5,
+    0x00bb8ce5, 0x00bb8ee5, 0x00bb8ee7, 0x00bb90e5, 0x00bb92e9, 0x00bb94e6,
+    0x00bb94e7, 0x00bb94e9, 0x00bb96e5, 0x00bb97e8, 0x00bb97e9, 0x00bb98e5,
+    0x00bb98e9, 0x00bb99e7, 0x00bba1e9, 0x00bba6e5, 0x00bba6e7, 0x00bba7e7,
+    0x00bba8e7, 0x00bba9e9, 0x00bbade6, 0x00bbafe5, 0x00bbafe8, 0x00bbb1e7,
+    0x00bbb2e6, 0x00bbb3e5, 0x00bbb3e6, 0x00bbb3e7, 0x00bbb4e6, 0x00bbb7e6,
+    0x00bbb8e4, 0x00bbb9e5, 0x00bbbae9, 0x00bbbbe4, 0x00bbbce9, 0x00bbbde5,
+    0x00bbbde8, 0x00bbbfe7, 0x00bc80e5, 0x00bc80e9, 0x00bc81e6, 0x00bc82e3,
+    0x00bc82e7, 0x00bc83e3, 0x00bc85e5, 0x00bc8be6, 0x00bc8be7, 0x00bc90e5,
+    0x00bc91e5, 0x00bc93e5, 0x00bc95e5, 0x00bc96e7, 0x00bc9ae5, 0x00bc9be6,
+    0x00bc9be7, 0x00bc9ce7, 0x00bca0e6, 0x00bca4e7, 0x00bca5e6, 0x00bca5e9,
+    0x00bca8e7, 0x00bca9e9, 0x00bcace7, 0x00bcace9, 0x00bcafe5, 0x00bcb0e5,
+    0x00bcb1e9, 0x00bcb3e6, 0x00bcb4e8, 0x00bcb9e5, 0x00bcbbe7, 0x00bcbce4,
+    0x00bcbde5, 0x00bcbfe7, 0x00bd82e3, 0x00bd83e8, 0x00bd83e9, 0x00bd85e5,
+    0x00bd87e5, 0x00bd88e7, 0x00bd8ae6, 0x00bd8ae8, 0x00bd8ce6, 0x00bd90e8,
+    0x00bd91e5, 0x00bd92e5, 0x00bd94e8, 0x00bd96e6, 0x00bd99e7, 0x00bd99e8,
+    0x00bd9be5, 0x00bd9ce6, 0x00bda0e6, 0x00bda1e9, 0x00bda5e5, 0x00bda6e7,
+    0x00bda7e6, 0x00bdaee5, 0x00bdb0e5, 0x00bdb1e6, 0x00bdb1e7, 0x00bdb3e6,
+    0x00bdb8e4, 0x00bdb8e5, 0x00bdb8e9, 0x00bdb9e5, 0x00bdbae7, 0x00bdbbe4,
+    0x00bdbde8, 0x00bdbee5, 0x00bdbee7, 0x00bdbee8, 0x00bdbfe5, 0x00bdbfe8,
+    0x00be80e5, 0x00be81e7, 0x00be82e3, 0x00be82e8, 0x00be84e8, 0x00be85e8,
+    0x00be89e6, 0x00be89e8, 0x00be8be5, 0x00be8be6, 0x00be90e5, 0x00be92e9,
+    0x00be93e9, 0x00be94e5, 0x00be94e6, 0x00be95e8, 0x00be96e7, 0x00be98e6,
+    0x00be99e7, 0x00be99e8, 0x00be9ae9, 0x00be9be5, 0x00be9be6, 0x00be9be7,
+    0x00be9be9, 0x00be9ce5, 0x00be9de6, 0x00bea1e9, 0x00bea4e7, 0x00bea9e9,
+    0x00beace6, 0x00beade7, 0x00beaee5, 0x00beaee8, 0x00beafe8, 0x00beb0e5,
+    0x00beb2e6, 0x00beb2e7, 0x00beb4e6, 0x00beb4e8, 0x00beb6e8, 0x00beb7e5,
+    0x00beb8e4, 0x00beb9e6, 0x00bebee8, 0x00bf81e5, 0x00bf81e7, 0x00bf81e9,
+    0x00bf82e3, 0x00bf82e8, 0x00bf84e5, 0x00bf84e6, 0x00bf85e8, 0x00bf85e9,
+    0x00bf88e6, 0x00bf89e6, 0x00bf8ae5, 0x00bf8be6, 0x00bf8ee5, 0x00bf94e6,
+    0x00bf95e9, 0x00bf98e5, 0x00bf98e9, 0x00bf9be6, 0x00bf9de6, 0x00bf9fe7,
+    0x00bfa1e9, 0x00bfa5e8, 0x00bfa5e9, 0x00bfa7e5, 0x00bfa8e7, 0x00bfa9e7,
+    0x00bfaee5, 0x00bfaee6, 0x00bfaee8, 0x00bfafe5, 0x00bfb0e5, 0x00bfb2e6,
+    0x00bfb8e9, 0x00bfb9e5, 0x00bfb9e6, 0x00bfb9e9, 0x00bfbae4, 0x00bfbae7,
+    0x00bfbbe4, 0x00bfbbe7, 0x00bfbde4, 0x00bfbde8, 0x00bfbde9, 0x00bfbee4,
+};
+
+
+extern const u16 glyph_table_values[2688] = {
+    39, 2737, 2738, 39, 2739, 39, 2740, 39, 2741, 39, 2742, 2756,
+    2743, 91, 2744, 43, 2745, 43, 2746, 43, 2747, 2748, 2749, 2750,
+    2751, 2752, 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2754, 2697,
+    2698, 2699, 2700, 2701, 2702, 2703, 2704, 84, 2705, 96, 74, 2706,
+    79, 2707, 2708, 2709, 2710, 2711, 90, 2712, 85, 2713, 185, 75,
+    2714, 80, 2715, 87, 2716, 2717, 76, 2718, 81, 2719, 88, 2720,
+    2721, 73, 2722, 2723, 77, 2724, 82, 2725, 2726, 92, 2727, 2728,
+    2755, 2729, 86, 2730, 78, 2731, 83, 2732, 89, 2733, 2734, 2735,
+    97, 2736, 662, 2221, 809, 275, 162, 2284, 1470, 1346, 790, 1192,
+    1998, 836, 1071, 1319, 2327, 1008, 203, 1510, 1175, 700, 938, 218,
+    499, 1992, 2161, 2316, 1027, 2491, 1803, 236, 2324, 1853, 1062, 1947,
+    563, 2040, 341, 1013, 2471, 1452, 1424, 308, 122, 1860, 2142, 2459,
+    539, 467, 559, 485, 2434, 453, 2226, 990, 1530, 624, 1503, 1883,
+    2310, 1807, 468, 2408, 618, 1081, 1617, 1980, 1736, 1786, 1762, 1535,
+    1432, 2412, 415, 417, 1533, 200, 1797, 2378, 2166, 1289, 1355, 1056,
+    1257, 1604, 2191, 1869, 336, 1591, 672, 1673, 1695, 2560, 1651, 379,
+    848, 1461, 448, 2647, 2688, 1712, 2263, 163, 482, 2183, 2558, 961,
+    1379, 255, 2309, 1812, 918, 2513, 1768, 1525, 699, 444, 229, 2198,
+    608, 2109, 1611, 800, 2134, 478, 389, 579, 541, 2211, 193, 327,
+    717, 1939, 2009, 191, 1826, 2086, 1568, 2470, 929, 267, 2685, 2288,
+    2683, 123, 2657, 1464, 1327, 2390, 708, 1744, 620, 687, 1366, 2219,
+    2326, 1616, 292, 1935, 2171, 1792, 1054, 826, 2387, 1465, 348, 1077,
+    1467, 1729, 2006, 748, 2347, 304, 1971, 667, 1384, 1945, 123, 241,
+    1093, 1577, 2679, 994, 1130, 1838, 720, 2540, 2299, 2179, 1480, 2442,
+    1017, 729, 572, 2207, 1096, 1104, 1223, 1335, 1396, 2155, 1011, 1488,
+    2403, 1721, 856, 828, 1839, 1823, 558, 2386, 932, 1996, 2113, 1418,
+    531, 164, 723, 2079, 1781, 2141, 611, 488, 2622, 842, 475, 2600,
+    2379, 2562, 928, 2022, 1515, 1024, 1549, 1305, 260, 2551, 2099, 2028,
+    2552, 877, 1687, 1474, 625, 388, 470, 256, 1631, 975, 1925, 1105,
+    405, 2437, 1696, 564, 1197, 731, 2553, 124, 1750, 210, 1413, 1145,
+    854, 1140, 1277, 638, 2547, 1051, 490, 2246, 2101, 2388, 1831, 2082,
+    588, 450, 1264, 1885, 689, 1391, 1609, 1394, 2315, 1371, 1921, 2048,
+    1412, 1873, 378, 1875, 277, 1999, 1402, 1486, 690, 2052, 1032, 2153,
+    1884, 261, 202, 452, 1084, 1911, 165, 1679, 2651, 575, 1367, 1623,
+    1232, 1793, 300, 747, 749, 956, 1033, 933, 1523, 2428, 2625, 2188,
+    765, 1934, 1954, 959, 1107, 1564, 1007, 511, 792, 1251, 592, 1438,
+    1193, 728, 912, 2542, 2406, 1565, 1851, 337, 2280, 1733, 333, 125,
+    705, 1429, 551, 725, 2125, 2144, 1881, 1253, 2192, 2015, 245, 1297,
+    1755, 743, 2024, 633, 1242, 217, 1150, 215, 2325, 2308, 2384, 871,
+    703, 665, 2485, 876, 469, 1385, 2559, 2162, 693, 936, 209, 1094,
+    2477, 2058, 371, 377, 1490, 166, 1929, 312, 796, 557, 248, 295,
+    1658, 1021, 1915, 1370, 1161, 1666, 1417, 1338, 1213, 1238, 374, 1069,
+    1121, 1680, 1710, 1747, 1699, 1956, 1258, 2466, 273, 2235, 631, 604,
+    629, 647, 1837, 1400, 799, 2238, 1859, 268, 1052, 2167, 2365, 760,
+    2671, 126, 653, 1064, 2555, 1043, 972, 1655, 1376, 2624, 2087, 2044,
+    502, 297, 1879, 1855, 456, 1181, 2195, 1112, 1814, 1410, 2571, 1114,
+    1349, 1878, 934, 516, 322, 187, 552, 691, 2504, 1621, 2481, 738,
+    1292, 1727, 2640, 955, 188, 243, 127, 534, 1944, 1484, 1169, 886,
+    2170, 1274, 805, 939, 2490, 385, 1562, 1887, 2473, 1957, 463, 2023,
+    325, 1953, 648, 1230, 1670, 609, 829, 540, 1780, 1871, 1674, 2131,
+    2370, 1136, 1399, 2377, 838, 2682, 1422, 1495, 194, 2133, 892, 1310,
+    270, 454, 2007, 128, 711, 612, 1977, 2335, 2649, 770, 401, 1654,
+    1725, 1168, 864, 368, 1905, 513, 1724, 1106, 1544, 424, 2411, 835,
+    1201, 525, 1164, 1552, 1950, 1309, 2014, 2236, 2672, 1469, 2174, 2425,
+    581, 2307, 783, 1194, 1390, 713, 2597, 38, 1603, 1979, 2010, 1087,
+    1672, 129, 2053, 1886, 2342, 2389, 2675, 442, 554, 593, 2661, 2494,
+    561, 2565, 1569, 1545, 2444, 1144, 1684, 1493, 396, 2506, 1180, 1083,
+    2046, 996, 2662, 704, 2572, 514, 2670, 496, 1626, 2635, 1307, 2668,
+    1858, 2616, 1635, 1308, 2357, 130, 1088, 1994, 750, 1512, 1266, 314,
+    2526, 2397, 832, 870, 1167, 2580, 446, 1690, 1315, 739, 1446, 1909,
+    412, 732, 702, 1057, 443, 2152, 1244, 1439, 2180, 1139, 1841, 361,
+    131, 2233, 1073, 777, 257, 1804, 846, 2084, 1254, 2349, 2071, 885,
+    1559, 841, 2585, 2081, 1893, 2419, 2297, 369, 2617, 1787, 1095, 1692,
+    2119, 1086, 1294, 1091, 282, 213, 1596, 1639, 823, 839, 2275, 607,
+    254, 1256, 2532, 397, 1382, 302, 344, 2395, 2319, 807, 167, 775,
+    2160, 1502, 2643, 2269, 1731, 476, 819, 1652, 915, 1942, 2122, 2352,
+    821, 293, 952, 2163, 2588, 1463, 1661, 2062, 227, 2217, 863, 2298,
+    735, 2187, 2446, 1894, 1537, 1117, 1282, 168, 1224, 2304, 437, 1840,
+    669, 1505, 439, 2521, 1876, 2465, 2026, 827, 2019, 1513, 1817, 1863,
+    1291, 2293, 440, 1177, 289, 1571, 2517, 1723, 2359, 1508, 1173, 1900,
+    422, 1990, 2505, 2302, 2392, 610, 2460, 1693, 537, 398, 2321, 2103,
+    1492, 406, 2456, 2243, 1317, 1200, 1357, 2523, 1845, 600, 1185, 2184,
+    692, 1419, 272, 132, 1924, 614, 1948, 1249, 1914, 303, 2557, 2518,
+    1023, 676, 668, 1343, 1183, 601, 335, 1485, 532, 352, 1210, 550,
+    409, 2145, 740, 2405, 926, 1519, 2290, 425, 2443, 404, 2003, 2489,
+    2364, 2564, 2030, 169, 583, 785, 2433, 744, 2074, 2584, 298, 2487,
+    1634, 2626, 2566, 1036, 1585, 2374, 722, 696, 1196, 850, 2545, 658,
+    1342, 2548, 2176, 1746, 1822, 2201, 736, 688, 1764, 321, 170, 686,
+    1726, 1333, 2239, 2018, 2169, 2529, 2536, 2291, 1501, 1638, 1707, 342,
+    2285, 1287, 834, 906, 873, 2637, 1270, 1558, 2061, 1668, 941, 271,
+    1329, 1628, 2270, 1820, 2240, 1004, 2645, 651, 1426, 983, 133, 1478,
+    1754, 852, 1669, 2045, 2128, 1933, 1901, 930, 1386, 1020, 1100, 2457,
+    2410, 1949, 1237, 2225, 411, 449, 965, 347, 2173, 555, 2107, 1217,
+    221, 1896, 1930, 1785, 1892, 171, 816, 865, 754, 1148, 1606, 1149,
+    1006, 1891, 196, 950, 759, 2601, 426, 1468, 524, 646, 1152, 2001,
+    2653, 1691, 1572, 1176, 2535, 586, 2254, 2096, 1583, 224, 2355, 2528,
+    375, 1663, 2627, 172, 264, 1153, 916, 1889, 216, 1864, 1665, 1261,
+    908, 473, 977, 2329, 2194, 1862, 1205, 1076, 1102, 605, 2602, 2231,
+    204, 1539, 226, 1345, 752, 2382, 1849, 1031, 1499, 673, 545, 851,
+    640, 927, 598, 1753, 1271, 219, 2294, 2502, 1323, 904, 134, 362,
+    1779, 1511, 1972, 345, 1101, 2049, 855, 2363, 2069, 2312, 1288, 1231,
+    1815, 2282, 212, 2495, 1059, 2573, 1732, 917, 2507, 1225, 1431, 1586,
+    356, 465, 1163, 358, 519, 1848, 1487, 2088, 2272, 1928, 980, 801,
+    1204, 173, 2589, 2035, 1103, 1108, 1610, 621, 2488, 2068, 2604, 2002,
+    862, 1491, 1962, 1867, 741, 2420, 1916, 589, 2189, 1116, 317, 1802,
+    2618, 414, 2522, 2051, 902, 281, 1166, 1774, 1852, 195, 1573, 1276,
+    2303, 1599, 2078, 418, 301, 1910, 174, 1861, 1401, 1987, 384, 1716,
+    570, 2305, 2665, 812, 2608, 989, 2266, 250, 623, 1676, 884, 2371,
+    2244, 2182, 1649, 1784, 2210, 1475, 332, 1387, 1648, 2008, 2056, 2525,
+    135, 1098, 992, 2032, 599, 2116, 1516, 1810, 1593, 2230, 562, 523,
+    2186, 503, 1567, 1967, 1968, 1372, 2323, 2591, 2164, 2020, 1681, 822,
+    283, 1212, 2114, 2076, 2478, 2147, 762, 1311, 2541, 1697, 1984, 65,
+    423, 1518, 175, 1191, 2508, 1243, 574, 199, 274, 1667, 2476, 1653,
+    650, 2592, 659, 2429, 2278, 964, 1560, 2650, 305, 386, 2606, 472,
+    1832, 737, 1047, 1625, 387, 1811, 284, 230, 1958, 339, 1143, 1922,
+    791, 971, 2289, 1760, 65, 1035, 2065, 1368, 176, 681, 733, 441,
+    979, 1442, 1364, 1580, 2575, 988, 1711, 2340, 652, 2344, 1147, 340,
+    326, 940, 492, 1819, 2399, 978, 527, 1000, 329, 943, 2568, 1645,
+    1689, 509, 2111, 1686, 136, 2317, 2154, 1138, 1361, 1633, 1248, 1719,
+    447, 197, 2664, 1113, 2296, 2281, 2396, 2151, 408, 2208, 756, 504,
+    2684, 429, 535, 2362, 451, 1316, 772, 1409, 1479, 937, 1966, 137,
+    567, 1566, 1756, 1955, 2631, 571, 660, 2202, 2257, 2013, 1988, 1662,
+    716, 1146, 679, 1789, 520, 2376, 334, 522, 654, 1546, 2486, 1775,
+    1281, 872, 1233, 793, 2467, 1660, 2567, 922, 2499, 553, 2073, 436,
+    2105, 769, 2286, 2681, 95, 923, 2593, 2265, 730, 1398, 1547, 138,
+    2605, 2318, 957, 383, 944, 2590, 2204, 1664, 247, 675, 2220, 480,
+    891, 2143, 1447, 914, 1735, 643, 745, 1951, 948, 1642, 1618, 697,
+    1286, 2398, 907, 494, 2612, 874, 1612, 1620, 2472, 670, 1717, 179,
+    2268, 139, 925, 1123, 789, 594, 2012, 706, 1029, 471, 1920, 967,
+    2137, 1946, 1019, 1414, 913, 461, 1991, 1085, 228, 814, 495, 2493,
+    1675, 590, 1830, 2036, 240, 2482, 1162, 416, 402, 2097, 2148, 1012,
+    1524, 373, 1250, 2500, 310, 2057, 2209, 225, 1865, 106, 1304, 140,
+    1538, 818, 784, 1216, 2417, 707, 831, 244, 1872, 1397, 269, 2454,
+    627, 1300, 1769, 491, 508, 1705, 279, 1782, 350, 1142, 1770, 2530,
+    2072, 2550, 2000, 1209, 438, 596, 894, 1025, 2402, 597, 2339, 2158,
+    2430, 180, 2680, 695, 2758, 2075, 1260, 727, 2150, 2177, 1718, 242,
+    455, 2129, 2655, 1644, 1299, 1041, 1312, 1263, 2687, 2168, 355, 400,
+    2149, 1927, 2197, 1613, 1026, 1425, 615, 107, 1890, 141, 320, 837,
+    641, 2102, 1997, 1395, 1605, 367, 2050, 2258, 1079, 1074, 634, 2241,
+    1808, 2372, 2369, 1688, 419, 1236, 1526, 746, 206, 2098, 1713, 1389,
+    2674, 1570, 1473, 2063, 2413, 2346, 803, 680, 970, 1354, 2659, 1772,
+    1507, 861, 198, 181, 1189, 2760, 2556, 1211, 2232, 1624, 880, 1895,
+    2581, 1657, 330, 1514, 2108, 905, 351, 1186, 1441, 2516, 847, 323,
+    2267, 2544, 2360, 1748, 2117, 942, 833, 288, 2648, 684, 1698, 1120,
+    2333, 2574, 263, 2229, 840, 1598, 1904, 265, 1328, 108, 1283, 1918,
+    142, 1337, 2034, 2479, 1182, 1154, 875, 1898, 1790, 2227, 2237, 2497,
+    2451, 2438, 2458, 1118, 1794, 656, 1045, 1471, 1322, 2416, 1022, 2619,
+    1430, 1706, 393, 949, 1636, 1961, 2582, 2123, 2610, 966, 2469, 1857,
+    909, 2115, 1053, 1241, 2449, 2336, 2628, 1320, 182, 2757, 1075, 1336,
+    981, 1834, 2512, 207, 2245, 2453, 1199, 1179, 1700, 973, 214, 2047,
+    582, 2094, 899, 2199, 954, 1615, 542, 1758, 1065, 1579, 1252, 2085,
+    2603, 1326, 331, 497, 1844, 771, 881, 109, 825, 1158, 143, 486,
+    276, 1608, 253, 1235, 2156, 1437, 1279, 1188, 2401, 2092, 2353, 1704,
+    817, 1965, 309, 580, 2126, 2373, 2264, 1246, 484, 343, 2118, 1646,
+    2380, 2206, 1554, 1228, 506, 2656, 420, 919, 1581, 2314, 2130, 1048,
+    1734, 1226, 2450, 802, 1016, 781, 445, 183, 2054, 144, 2492, 766,
+    1650, 813, 986, 1993, 1321, 931, 370, 1072, 1740, 806, 1907, 1458,
+    285, 2421, 683, 666, 682, 2578, 1923, 577, 1453, 1137, 2354, 763,
+    2669, 1536, 1190, 2511, 889, 2060, 1932, 2256, 2260, 1324, 1983, 2385,
+    515, 2110, 2666, 2667, 110, 1656, 145, 1776, 2455, 529, 2031, 1796,
+    815, 866, 2361, 2017, 2658, 664, 1060, 1743, 2185, 1411, 671, 1527,
+    1783, 1937, 1280, 657, 2016, 712, 2274, 357, 1494, 2534, 893, 434,
+    1903, 2543, 2484, 1982, 860, 2418, 1582, 1273, 632, 1960, 1459, 1344,
+    2632, 372, 111, 146, 2138, 1738, 945, 868, 1063, 1548, 900, 1373,
+    2320, 617, 458, 1356, 2636, 1383, 1040, 2496, 189, 1416, 2090, 1728,
+    1460, 1219, 858, 2576, 2633, 1759, 1290, 353, 1588, 1428, 751, 569,
+    2424, 211, 403, 2445, 152, 1496, 1423, 147, 2127, 1880, 2463, 1745,
+    1314, 984, 237, 1975, 1763, 1912, 512, 2248, 1405, 2475, 392, 510,
+    960, 758, 1767, 1363, 867, 820, 1157, 721, 2531, 2041, 1541, 1517,
+    896, 2181, 1125, 1827, 1816, 1715, 112, 1115, 148, 457, 1489, 381,
+    1014, 1702, 2539, 1070, 548, 1576, 2135, 306, 724, 1155, 2295, 2331,
+    1436, 518, 2132, 2193, 399, 946, 1037, 1171, 1974, 639, 1055, 878,
+    1218, 2427, 234, 1730, 1913, 1403, 2546, 2251, 782, 153, 2252, 2480,
+    2759, 1229, 2663, 316, 192, 2345, 1919, 538, 1854, 1985, 359, 413,
+    2394, 626, 1374, 2139, 2255, 1659, 1451, 547, 530, 2338, 1742, 1381,
+    1214, 2452, 602, 1295, 2474, 2468, 1239, 2064, 313, 1245, 1082, 2222,
+    2025, 1039, 113, 982, 149, 483, 421, 2175, 1434, 2311, 1846, 2678,
+    1959, 1805, 1522, 1550, 431, 1172, 1159, 2646, 565, 2533, 2510, 1268,
+    1531, 1722, 1078, 1500, 2563, 2351, 1809, 843, 307, 962, 897, 2043,
+    773, 2083, 603, 2549, 1038, 232, 726, 2509, 1587, 1156, 969, 1477,
+    231, 154, 2077, 1528, 1058, 259, 2112, 2587, 208, 365, 481, 2234,
+    2287, 2407, 1813, 2432, 761, 1174, 845, 1773, 824, 883, 2652, 2262,
+    252, 266, 1393, 1752, 1042, 479, 1791, 1005, 985, 685, 1018, 324,
+    2038, 779, 1404, 1066, 521, 114, 1906, 1240, 1208, 1415, 376, 1126,
+    2249, 2641, 1543, 968, 1557, 795, 698, 1427, 2409, 346, 1739, 1198,
+    2519, 1969, 1444, 1647, 1435, 1099, 719, 500, 701, 1221, 2200, 223,
+    797, 1255, 1825, 810, 2447, 1332, 1720, 1619, 1899, 1509, 155, 898,
+    2620, 920, 150, 1842, 1165, 1296, 2300, 2348, 220, 566, 644, 2569,
+    556, 1877, 1534, 715, 694, 328, 1795, 1749, 1359, 2334, 2439, 1009,
+    2594, 2638, 642, 1378, 2561, 911, 709, 1828, 2029, 1278, 498, 391,
+    1455, 115, 151, 474, 998, 1902, 1575, 830, 674, 1777, 1757, 489,
+    2609, 2514, 2004, 1540, 493, 767, 1856, 1941, 1553, 1708, 1302, 201,
+    2165, 584, 1090, 2426, 677, 1445, 1215, 2554, 2583, 1303, 616, 1348,
+    233, 1220, 2448, 2093, 235, 156, 178, 2172, 2203, 1602, 1388, 2391,
+    808, 1952, 1481, 1080, 2673, 2621, 1694, 1284, 1989, 1761, 464, 1331,
+    1806, 1964, 1766, 2381, 2464, 2124, 2059, 1462, 2520, 526, 974, 1801,
+    280, 888, 1737, 382, 517, 1824, 2205, 2630, 1908, 798, 2537, 1682,
+    246, 1457, 2279, 116, 536, 428, 1122, 1362, 2070, 354, 462, 2178,
+    2404, 2350, 1449, 1683, 630, 786, 2301, 1584, 1109, 1940, 2614, 2498,
+    2435, 1630, 1340, 976, 2423, 1637, 1380, 2527, 778, 157, 287, 364,
+    1629, 2611, 1187, 1129, 1227, 714, 2677, 921, 787, 901, 1594, 1506,
+    887, 774, 857, 1092, 1943, 1450, 1818, 1627, 1578, 1970, 1632, 963,
+    2615, 1833, 2120, 1097, 315, 487, 1267, 2306, 2247, 2271, 1788, 299,
+    117, 2253, 585, 999, 2283, 2343, 2538, 622, 879, 430, 1127, 505,
+    1124, 1178, 1521, 1677, 363, 2515, 1874, 2642, 2159, 924, 2242, 2415,
+    2393, 1640, 1931, 1454, 1275, 1574, 637, 2341, 2250, 2503, 1938, 394,
+    1555, 2441, 158, 2042, 1195, 2328, 1206, 190, 1607, 1318, 338, 1798,
+    1110, 1590, 2106, 2660, 1050, 764, 1352, 1325, 794, 895, 628, 882,
+    2596, 1963, 1592, 2292, 1563, 349, 1135, 1046, 2436, 1641, 903, 1089,
+    1778, 2462, 2039, 1821, 645, 118, 568, 2676, 2027, 2577, 533, 1222,
+    2579, 1709, 591, 380, 649, 1771, 2598, 1448, 2089, 1420, 1170, 2629,
+    1843, 910, 2276, 1882, 1061, 935, 2190, 2431, 2383, 587, 360, 1262,
+    262, 1049, 1888, 2146, 1002, 1203, 546, 1010, 1339, 477, 249, 849,
+    2218, 710, 159, 1850, 1978, 1306, 1589, 1976, 1184, 1001, 278, 395,
+    573, 869, 804, 1358, 507, 1160, 947, 1551, 1128, 286, 1482, 636,
+    1926, 1622, 2654, 2273, 661, 1132, 1504, 1466, 2033, 1520, 2091, 2599,
+    1714, 2215, 1600, 2037, 119, 1392, 319, 184, 2440, 1301, 427, 1272,
+    1365, 768, 2157, 1751, 2011, 390, 2400, 501, 238, 2080, 2613, 2595,
+    1601, 2366, 1614, 2136, 2121, 718, 1829, 1375, 1369, 1028, 1868, 1259,
+    755, 1360, 788, 1377, 2228, 549, 1151, 2586, 2634, 2461, 2332, 2356,
+    2212, 2422, 997, 613, 844, 160, 318, 177, 811, 991, 1003, 663,
+    1835, 2501, 1131, 776, 1407, 853, 1298, 753, 543, 1207, 205, 576,
+    859, 1476, 433, 366, 1497, 1030, 1765, 1456, 951, 2095, 578, 1350,
+    1440, 1443, 120, 2216, 995, 953, 222, 1643, 2100, 619, 1917, 251,
+    1111, 655, 1529, 1293, 2213, 1408, 2639, 1678, 987, 296, 1269, 1561,
+    2483, 2214, 1330, 2368, 2055, 2223, 239, 1015, 1313, 757, 1701, 1799,
+    1556, 2322, 1341, 1866, 1133, 678, 1847, 890, 161, 2067, 466, 2337,
+    1347, 1472, 734, 2277, 1836, 294, 2261, 1532, 2313, 1351, 2358, 742,
+    1265, 1800, 1044, 2570, 2224, 993, 460, 459, 1334, 1595, 1671, 1498,
+    1703, 407, 544, 2524, 1936, 958, 311, 1034, 560, 2104, 2414, 291,
+    2686, 1995, 2066, 2140, 2607, 1247, 121, 1870, 2375, 1141, 1981, 290,
+    1068, 1542, 606, 1119, 2367, 258, 2021, 1406, 1973, 2005, 595, 1067,
+    2644, 1353, 410, 1597, 1433, 528, 2623, 1202, 1134, 1741, 780, 1483,
+    1234, 2330, 432, 1897, 435, 1685, 1986, 2259, 2196, 1421, 1285, 635,
+};
+
+
+extern const u32 glyph_table_size = 2688;
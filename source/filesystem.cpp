@@ -71,7 +71,8 @@ bool Filesystem::init(Platform& pfrm)
 
 struct FileInfo {
     char name_[32];
-    char size_[16];
+    char size_[15];
+    u8 compression_; // zero for uncompressed files
     // data[]...
     // null terminator
     // padding (for word alignment)
@@ -92,7 +93,17 @@ int tonum(const char* str)
 
 Filesystem::FileData Filesystem::get_file(int address, int len)
 {
-    return {(const char*)(intptr_t)address, (u32)len};
+    Filesystem::FileData result{(const char*)(intptr_t)address, (u32)len};
+
+    // Scripts get addresses from file(), so the address usually points to the
+    // start of a file, right after its header. Trust the header only if it
+    // agrees about the file's size, as the address could point anywhere.
+    auto info = reinterpret_cast<const FileInfo*>(result.data_) - 1;
+    if (tonum(info->size_) == len) {
+        result.compression_ = info->compression_;
+    }
+
+    return result;
 }
 
 
@@ -106,7 +117,8 @@ Filesystem::FileData Filesystem::next_file(int address, int len)
         reinterpret_cast<const FileInfo*>((const char*)(intptr_t)address);
 
     return {(const char*)current + sizeof(FileInfo),
-            (u32)tonum(current->size_)};
+            (u32)tonum(current->size_),
+            current->compression_};
 }
 
 
@@ -120,7 +132,8 @@ Filesystem::FileData Filesystem::get_file(const char* name)
     while (true) {
         if (str_cmp(name, current->name_) == 0) {
             return {reinterpret_cast<const char*>(current) + sizeof(FileInfo),
-                    static_cast<u32>(tonum(current->size_))};
+                    static_cast<u32>(tonum(current->size_)),
+                    current->compression_};
         } else if (current->name_[0] not_eq '\0') {
             auto skip = tonum(current->size_) + 1; // +1 for null terminator
             skip += skip % 4;                      // word padding
@@ -15,6 +15,11 @@ public:
     struct FileData {
         const char* data_;
         u32 size_;
+
+        // Zero, unless build.lua compressed the file, in which case it holds
+        // the bios compression type, recorded in the file's bundle header (see
+        // gba_platform_compression.hpp).
+        u8 compression_ = 0;
     };
 
     FileData get_file(const char* filename);
@@ -37,7 +37,8 @@ void Text::erase()
 
 
 Text::Text(Text&& from)
-    : pfrm_(from.pfrm_), coord_(from.coord_), len_(from.len_)
+    : pfrm_(from.pfrm_), coord_(from.coord_), len_(from.len_),
+      colors_(from.colors_)
 {
     from.len_ = 0;
 }
@@ -134,6 +135,57 @@ void Text::append(const char* str, const OptColors& colors)
 }
 
 
+static bool same_colors(const Text::OptColors& lhs, const Text::OptColors& rhs)
+{
+    if (lhs and rhs) {
+        return lhs->foreground_ == rhs->foreground_ and
+               lhs->background_ == rhs->background_;
+    }
+    return static_cast<bool>(lhs) == static_cast<bool>(rhs);
+}
+
+
+void Text::set(const char* str, const OptColors& colors)
+{
+    if (str == nullptr or not validate_str(str)) {
+        return;
+    }
+
+    // If the colors changed, every cell needs a new palette, so there's
+    // nothing to gain from comparing tiles.
+    const bool recolor = not same_colors(colors, colors_);
+
+    Length pos = 0;
+
+    utf8::scan(
+        [&](const utf8::Codepoint& cp, const char* raw, int) {
+            const u8 x = coord_.x + pos;
+
+            if (recolor or pos >= len_) {
+                print_char(pfrm_, cp, {x, coord_.y}, colors);
+            } else {
+                TileDesc t = 0;
+                if (cp not_eq 0) {
+                    t = pfrm_.map_glyph(cp, locale_texture_map());
+                }
+                if (pfrm_.get_tile(Layer::overlay, x, coord_.y) not_eq t) {
+                    print_char(pfrm_, cp, {x, coord_.y}, colors);
+                }
+            }
+            ++pos;
+        },
+        str,
+        str_len(str));
+
+    for (int i = pos; i < len_; ++i) {
+        pfrm_.set_tile(Layer::overlay, coord_.x + i, coord_.y, 0);
+    }
+
+    len_ = pos;
+    colors_ = colors;
+}
+
+
 void Text::append(int num, const OptColors& colors)
 {
     std::array<char, 40> buffer = {0};
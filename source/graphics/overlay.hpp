@@ -37,6 +37,11 @@ public:
     void append(const char* str, const OptColors& colors = {});
     void append(int num, const OptColors& colors = {});
 
+    // Like assign(), but compares the new string against what's already on
+    // screen, and only rewrites the cells that changed. Meant for text that
+    // gets redrawn every frame, like a hud.
+    void set(const char* str, const OptColors& colors = {});
+
     void erase();
 
     using Length = u16;
@@ -57,6 +62,7 @@ private:
     Platform& pfrm_;
     const OverlayCoord coord_;
     Length len_;
+    OptColors colors_;
 };
 
 
@@ -115,3 +115,35 @@ Sprite::Size Sprite::get_size() const
 {
     return static_cast<Sprite::Size>(size_);
 }
+
+
+Vec2<int> Sprite::dimensions(Size size)
+{
+    switch (size) {
+    case w8_h8:
+        return {8, 8};
+    case w16_h16:
+        break;
+    case w32_h32:
+        return {32, 32};
+    case w64_h64:
+        return {64, 64};
+    case w16_h8:
+        return {16, 8};
+    case w32_h8:
+        return {32, 8};
+    case w32_h16:
+        return {32, 16};
+    case w64_h32:
+        return {64, 32};
+    case w8_h16:
+        return {8, 16};
+    case w8_h32:
+        return {8, 32};
+    case w16_h32:
+        return {16, 32};
+    case w32_h64:
+        return {32, 64};
+    }
+    return {16, 16};
+}
@@ -17,7 +17,28 @@ public:
         count
     };
 
-    enum Size : u8 { w16_h16 };
+    // NOTE: Scripts refer to sizes by their numeric value, so only ever append
+    // new sizes to the end of the list.
+    enum Size : u8 {
+        w16_h16,
+        w8_h8,
+        w32_h32,
+        w64_h64,
+        w16_h8,
+        w32_h8,
+        w32_h16,
+        w64_h32,
+        w8_h16,
+        w8_h32,
+        w16_h32,
+        w32_h64,
+    };
+
+    static constexpr int size_count = w32_h64 + 1;
+
+
+    // Width and height, in pixels.
+    static Vec2<int> dimensions(Size size);
 
     enum Flags1 : u8 {};
     enum Flags2 : u8 {};
@@ -90,16 +111,15 @@ private:
     // memory. Packing the engine into 32kB has benefits for other platforms
     // too--this game is very cache-friendly.
     u8 alpha_ : 2;
-    u8 size_ : 1;
+    u8 size_ : 4;
     bool flip_x_ : 1;
     bool flip_y_ : 1;
 
     // Extra flags reserved for future use.
-    u8 flags1_ : 3;
     u8 flags2_ : 8;
 
-    // Because sprites are only 16x32 or 32x32, 16bits for the origin field is
-    // quite generous...
+    // Because sprites are at most 64x64, 16bits for the origin field is quite
+    // generous...
     Vec2<s16> origin_;
 
     Vec2<s16> scale_;
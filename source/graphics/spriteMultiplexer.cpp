@@ -0,0 +1,257 @@
+#include "spriteMultiplexer.hpp"
+
+
+void SpriteMultiplexer::heap_swap(int a, int b)
+{
+    const auto tmp = heap_[a];
+    heap_[a] = heap_[b];
+    heap_[b] = tmp;
+
+    heap_pos_[heap_[a]] = a;
+    heap_pos_[heap_[b]] = b;
+}
+
+
+void SpriteMultiplexer::heap_sift_up(int pos)
+{
+    while (pos > 0) {
+        const int parent = (pos - 1) / 2;
+        if (not heap_less(pos, parent)) {
+            return;
+        }
+        heap_swap(pos, parent);
+        pos = parent;
+    }
+}
+
+
+void SpriteMultiplexer::heap_sift_down(int pos)
+{
+    while (true) {
+        const int left = pos * 2 + 1;
+        const int right = left + 1;
+        int least = pos;
+
+        if (left < heap_size_ and heap_less(left, least)) {
+            least = left;
+        }
+        if (right < heap_size_ and heap_less(right, least)) {
+            least = right;
+        }
+        if (least == pos) {
+            return;
+        }
+        heap_swap(pos, least);
+        pos = least;
+    }
+}
+
+
+void SpriteMultiplexer::heap_push(Slot slot)
+{
+    heap_[heap_size_] = slot;
+    heap_pos_[slot] = heap_size_;
+    heap_sift_up(heap_size_++);
+}
+
+
+void SpriteMultiplexer::heap_update(Slot slot, u16 free_line)
+{
+    const auto prev = free_line_[slot];
+    free_line_[slot] = free_line;
+
+    if (free_line < prev) {
+        heap_sift_up(heap_pos_[slot]);
+    } else {
+        heap_sift_down(heap_pos_[slot]);
+    }
+}
+
+
+static int clamp_line(int line)
+{
+    if (line < 0) {
+        return 0;
+    }
+    if (line > SpriteMultiplexer::screen_lines) {
+        return SpriteMultiplexer::screen_lines;
+    }
+    return line;
+}
+
+
+// Hand a slot over to an object at a given top scanline, by scheduling an
+// attribute rewrite in an hblank after the slot's current occupant finishes
+// drawing, and before the new object starts. We search from the latest
+// possible line upwards, so that we stay as far away as possible from the
+// previous occupant.
+bool SpriteMultiplexer::assign_rewrite(ObjectIndex obj, Slot slot, int top)
+{
+    const int earliest = free_line_[slot] - rewrite_lead;
+    const int lo = earliest < 0 ? 0 : earliest;
+
+    for (int line = top - rewrite_lead; line >= lo; --line) {
+        if (line_load_[line] < max_rewrites_per_line) {
+            ++line_load_[line];
+
+            auto& rw = rewrites_[rewrite_count_];
+            rw.line_ = line;
+            rw.slot_ = slot;
+            rw.object_ = obj;
+
+            occupant_[slot] = obj;
+            occupant_rewrite_[slot] = rewrite_count_++;
+            shown_.set(obj, true);
+
+            heap_update(slot, clamp_line(top + objects_[obj].height_));
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+// When we run out of slots, an object that was dropped during the previous
+// frame takes over a slot from an object that was displayed. The victim's
+// initial entry or rewrite was already valid for a sprite starting at or
+// before this object's top line, so the new occupant can re-use it as-is.
+bool SpriteMultiplexer::steal_slot(ObjectIndex obj, int top)
+{
+    for (int slot = 0; slot < hardware_slots; ++slot) {
+        const auto victim = occupant_[slot];
+
+        if (victim == null_object or starved_[victim]) {
+            continue;
+        }
+
+        const auto rw = occupant_rewrite_[slot];
+        if (rw == -1) {
+            initial_[slot] = obj;
+        } else {
+            rewrites_[rw].object_ = obj;
+        }
+
+        shown_.set(victim, false);
+        shown_.set(obj, true);
+        occupant_[slot] = obj;
+        ++dropped_count_;
+
+        heap_update(slot, clamp_line(top + objects_[obj].height_));
+
+        return true;
+    }
+
+    return false;
+}
+
+
+int SpriteMultiplexer::schedule()
+{
+    dropped_count_ = 0;
+    rewrite_count_ = 0;
+    heap_size_ = 0;
+    shown_.clear();
+
+    for (auto& load : line_load_) {
+        load = 0;
+    }
+
+    for (int slot = 0; slot < hardware_slots; ++slot) {
+        initial_[slot] = null_object;
+        occupant_[slot] = null_object;
+        occupant_rewrite_[slot] = -1;
+    }
+
+    // Counting sort by top scanline. Objects starting below the bottom of the
+    // screen land in the last bucket, and we skip them entirely.
+    u16 bucket[screen_lines + 1] = {0};
+
+    for (int i = 0; i < count_; ++i) {
+        ++bucket[clamp_line(objects_[i].top_)];
+    }
+
+    const int visible = count_ - bucket[screen_lines];
+
+    int offset = 0;
+    for (auto& b : bucket) {
+        const int n = b;
+        b = offset;
+        offset += n;
+    }
+
+    for (int i = 0; i < count_; ++i) {
+        order_[bucket[clamp_line(objects_[i].top_)]++] = i;
+    }
+
+    // The topmost objects are loaded into OAM directly at the start of the
+    // frame. We hand out slots in submission order, because the hardware draws
+    // lower slots on top of higher ones, and we want to preserve the layering
+    // that the caller asked for.
+    const int initial_count =
+        visible < hardware_slots ? visible : hardware_slots;
+
+    Bitvector<capacity> in_initial_set;
+    for (int i = 0; i < initial_count; ++i) {
+        in_initial_set.set(order_[i], true);
+    }
+
+    int slot = 0;
+    for (int i = 0; i < count_; ++i) {
+        if (in_initial_set[i]) {
+            initial_[slot] = i;
+            occupant_[slot] = i;
+            const auto& o = objects_[i];
+            free_line_[slot] = clamp_line(o.top_ + o.height_);
+            shown_.set(i, true);
+            ++slot;
+        }
+    }
+
+    for (; slot < hardware_slots; ++slot) {
+        free_line_[slot] = 0;
+    }
+
+    for (int s = 0; s < hardware_slots; ++s) {
+        heap_push(s);
+    }
+
+    // Everything else needs to wait for a slot to free up.
+    for (int i = initial_count; i < visible; ++i) {
+        const auto obj = order_[i];
+        const int top = clamp_line(objects_[obj].top_);
+        const auto candidate = heap_[0];
+
+        if (free_line_[candidate] <= top and
+            assign_rewrite(obj, candidate, top)) {
+            continue;
+        }
+
+        if (starved_[obj] and steal_slot(obj, top)) {
+            continue;
+        }
+
+        ++dropped_count_;
+    }
+
+    starved_.clear();
+    for (int i = 0; i < visible; ++i) {
+        if (not shown_[order_[i]]) {
+            starved_.set(order_[i], true);
+        }
+    }
+
+    // Finally, sort the rewrites by line, for the hblank handler.
+    u16 line_offset[screen_lines] = {0};
+    for (int line = 0, pos = 0; line < screen_lines; ++line) {
+        line_offset[line] = pos;
+        pos += line_load_[line];
+    }
+
+    for (int i = 0; i < rewrite_count_; ++i) {
+        sorted_rewrites_[line_offset[rewrites_[i].line_]++] = rewrites_[i];
+    }
+
+    return dropped_count_;
+}
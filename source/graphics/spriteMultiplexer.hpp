@@ -0,0 +1,161 @@
+#pragma once
+
+#include "bitvector.hpp"
+#include "number/numeric.hpp"
+#include "util.hpp"
+
+
+// The gameboy advance can only display 128 hardware sprites at a time. But the
+// display hardware fetches object attributes one scanline at a time, so once a
+// sprite has finished drawing, we can rewrite its object attribute memory
+// entry during an hblank, and re-use the slot for another sprite further down
+// the screen. The SpriteMultiplexer does all of the bookkeeping for this: it
+// sorts a frame's worth of sprites by their top scanline, hands out the
+// hardware slots, and produces a list of rewrites for the hblank handler to
+// apply. None of this code touches the hardware, so it works on any platform.
+//
+// When too many sprites overlap the same scanlines to fit in the hardware
+// slots, the multiplexer falls back to flicker rotation: sprites that were
+// dropped in the previous frame take a slot from a sprite that was displayed,
+// so that every sprite in a crowded band shows up at least every other frame.
+
+
+class SpriteMultiplexer {
+public:
+    static constexpr int hardware_slots = 128;
+    static constexpr int capacity = 256;
+    static constexpr int screen_lines = 160;
+
+    // The hblank handler only has a couple hundred cycles to work with, so we
+    // limit the number of entries that it needs to rewrite on any single line.
+    static constexpr int max_rewrites_per_line = 4;
+
+    // Attributes written during the hblank of line L are first used to render
+    // line L + 2, because the display hardware evaluates sprites one line
+    // ahead.
+    static constexpr int rewrite_lead = 2;
+
+    using ObjectIndex = u16;
+    using Slot = u8;
+
+    static constexpr ObjectIndex null_object = 0xffff;
+
+    struct Object {
+        u16 attr0_;
+        u16 attr1_;
+        u16 attr2_;
+        s16 top_;
+        u16 height_;
+    };
+
+    struct Rewrite {
+        u8 line_;
+        Slot slot_;
+        ObjectIndex object_;
+    };
+
+
+    void clear()
+    {
+        count_ = 0;
+    }
+
+
+    // Returns false if the multiplexer has no room left for the object.
+    bool push(const Object& obj)
+    {
+        if (UNLIKELY(count_ == capacity)) {
+            return false;
+        }
+        objects_[count_++] = obj;
+        return true;
+    }
+
+
+    int size() const
+    {
+        return count_;
+    }
+
+
+    const Object& get(ObjectIndex index) const
+    {
+        return objects_[index];
+    }
+
+
+    // Assign hardware slots and build the rewrite list. Returns the number of
+    // objects that could not be displayed this frame.
+    int schedule();
+
+
+    // The object that should be loaded into each hardware slot at the start of
+    // the frame, or null_object if the slot is unused.
+    ObjectIndex initial(Slot slot) const
+    {
+        return initial_[slot];
+    }
+
+
+    // Rewrites, sorted by line.
+    int rewrite_count() const
+    {
+        return rewrite_count_;
+    }
+
+    const Rewrite& rewrite(int index) const
+    {
+        return sorted_rewrites_[index];
+    }
+
+
+    int dropped() const
+    {
+        return dropped_count_;
+    }
+
+
+private:
+    bool heap_less(int a, int b) const
+    {
+        return free_line_[heap_[a]] < free_line_[heap_[b]];
+    }
+
+    void heap_swap(int a, int b);
+    void heap_sift_up(int pos);
+    void heap_sift_down(int pos);
+    void heap_push(Slot slot);
+    void heap_update(Slot slot, u16 free_line);
+
+    bool assign_rewrite(ObjectIndex obj, Slot slot, int top);
+    bool steal_slot(ObjectIndex obj, int top);
+
+    // Input
+    Object objects_[capacity];
+    int count_ = 0;
+
+    // Objects sorted by top scanline.
+    ObjectIndex order_[capacity];
+
+    // Slot assignment state. free_line_ holds the first scanline at which a
+    // slot's current occupant no longer displays.
+    ObjectIndex initial_[hardware_slots];
+    ObjectIndex occupant_[hardware_slots];
+    s16 occupant_rewrite_[hardware_slots];
+    u16 free_line_[hardware_slots];
+    Slot heap_[hardware_slots];
+    u8 heap_pos_[hardware_slots];
+    int heap_size_ = 0;
+
+    u8 line_load_[screen_lines];
+
+    Rewrite rewrites_[capacity];
+    Rewrite sorted_rewrites_[capacity];
+    int rewrite_count_ = 0;
+
+    // Objects dropped during the previous frame, indexed by submission
+    // order. Used for flicker rotation.
+    Bitvector<capacity> starved_;
+    Bitvector<capacity> shown_;
+    int dropped_count_ = 0;
+};
@@ -25,14 +25,15 @@
 #include "SFML/System.hpp"
 #include <chrono>
 #include <cmath>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <list>
 // The game logic and graphics used to run on different threads. But the game is
 // efficient enough to run on a gameboy, so there isn't really any need for
-// threading.
-// #include <mutex>
+// threading. Except for SFML's audio thread, see SpeakerAudioSink.
+#include <mutex>
 #include <popl/popl.hpp>
 #include <queue>
 #include <sstream>
@@ -179,10 +180,6 @@ public:
 
     Vec2<u32> window_size_;
 
-    // std::mutex audio_lock_;
-    sf::Music music_;
-    std::list<sf::Sound> sounds_;
-    std::map<std::string, sf::SoundBuffer> sound_data_;
 
 
     Data(Platform& pfrm)
@@ -229,35 +226,6 @@ public:
         if (not vignette_texture_.loadFromFile(vignette_path)) {
             error(pfrm, "failed to load vignette texture");
         }
-
-        auto sound_folder = resource_path() + ("sounds" PATH_DELIMITER);
-        // lisp::loadv<lisp::Symbol>("sound-dir").name_;
-
-        for (auto& dirent : std::filesystem::directory_iterator(sound_folder)) {
-            const auto filename = dirent.path().stem().string();
-            static const std::string prefix("sound_");
-            const auto prefix_loc = filename.find(prefix);
-
-            if (prefix_loc not_eq std::string::npos) {
-                std::ifstream file_data(dirent.path(), std::ios::binary);
-                std::vector<s8> buffer(
-                    std::istreambuf_iterator<char>(file_data), {});
-
-                // The gameboy advance sound data was 8 bit signed mono at
-                // 16kHz. Here, we're upsampling to 16bit signed.
-                std::vector<s16> upsampled;
-
-                for (s8 sample : buffer) {
-                    upsampled.push_back(sample << 8);
-                }
-
-                sf::SoundBuffer sound_buffer;
-                sound_buffer.loadFromSamples(
-                    upsampled.data(), upsampled.size(), 1, 16000);
-
-                sound_data_[filename.substr(prefix.size())] = sound_buffer;
-            }
-        }
     }
 };
 
@@ -650,6 +618,9 @@ void Platform::push_task(Task* task)
 }
 
 
+static void audio_update();
+
+
 void Platform::Screen::clear()
 {
     for (auto it = task_queue.begin(); it not_eq task_queue.end();) {
@@ -670,17 +641,7 @@ void Platform::Screen::clear()
     ::platform->data()->fade_overlay_.setFillColor(
         ::platform->data()->fade_color_);
 
-    {
-        // std::lock_guard<std::mutex> guard(::platform->data()->audio_lock_);
-        auto& sounds = ::platform->data()->sounds_;
-        for (auto it = sounds.begin(); it not_eq sounds.end();) {
-            if (it->getStatus() == sf::Sound::Status::Stopped) {
-                it = sounds.erase(it);
-            } else {
-                ++it;
-            }
-        }
-    }
+    audio_update();
 
     {
         // std::lock_guard<std::mutex> guard(texture_swap_mutex);
@@ -983,8 +944,13 @@ sf::View get_letterbox_view(sf::View view, int window_width, int window_height)
 }
 
 
+static void update_animated_tiles();
+
+
 void Platform::Screen::display()
 {
+    update_animated_tiles();
+
     sf::View view;
     view.setSize(view_.get_size().x, view_.get_size().y);
 
@@ -1119,14 +1085,10 @@ void Platform::Screen::display()
 
         sf_spr.setTexture(::platform->data()->spritesheet_texture_);
 
-        switch (const auto ind = spr.get_texture_index(); spr.get_size()) {
-        case Sprite::Size::w16_h32:
-            sf_spr.setTextureRect({static_cast<s32>(ind) * 16, 0, 16, 32});
-            break;
-
-        case Sprite::Size::w32_h32:
-            sf_spr.setTextureRect({static_cast<s32>(ind) * 32, 0, 32, 32});
-            break;
+        {
+            const auto ind = static_cast<s32>(spr.get_texture_index());
+            const auto d = Sprite::dimensions(spr.get_size());
+            sf_spr.setTextureRect({ind * d.x, 0, d.x, d.y});
         }
 
         if (const auto& mix = spr.get_mix();
@@ -1231,11 +1193,311 @@ void Platform::Screen::draw(const Sprite& spr)
 }
 
 
+Platform::Screen::SpriteCacheStats Platform::Screen::sprite_cache_stats() const
+{
+    // The desktop version loads the whole spritesheet into a texture.
+    return {};
+}
+
+
+u32 Platform::Screen::overlay_copy_bytes() const
+{
+    return 0;
+}
+
+
+std::optional<Platform::FailureReason>
+Platform::Screen::check_sprite_size(Sprite::Size) const
+{
+    return {};
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 // Speaker
 ////////////////////////////////////////////////////////////////////////////////
 
 
+// The desktop speaker plays the same 8-bit 16kHz raw audio from the resource
+// bundle as the gameboy advance, and mixes it with the same mixer code, so that
+// games sound the same on both platforms, and so that we can measure the cost
+// of the audio code on the host. The mixer runs on the main thread, once per
+// frame, and hands the mixed samples to a sink:
+//
+// speaker - plays the audio through SFML (default)
+// null    - throws the audio away, for headless runs and benchmarks
+// *.wav   - writes the audio to a wav file
+//
+// Select a sink with the --audio option, e.g. --audio=null. The null and wav
+// sinks consume samples at a fixed rate of one frame's worth per frame, rather
+// than in real time, so that headless runs produce the same output every time.
+
+
+#include "platform/gba/gba_platform_mixer.hpp"
+#include "platform/gba/gba_platform_music.hpp"
+
+
+static const int audio_sample_rate = 16000;
+
+
+class AudioSink {
+public:
+    virtual ~AudioSink()
+    {
+    }
+
+    // The number of samples that the sink would like us to mix next.
+    virtual int samples_wanted() = 0;
+
+    virtual void write(const AudioSample* samples, int count) = 0;
+};
+
+
+class FixedRateAudioSink : public AudioSink {
+public:
+    int samples_wanted() override
+    {
+        // Sixty frames per second. The mixer works four samples at a time, so
+        // carry the remainder over to the next frame.
+        owed_ += audio_sample_rate;
+        const int count = (owed_ / 60) & ~3;
+        owed_ -= count * 60;
+        return count;
+    }
+
+private:
+    int owed_ = 0;
+};
+
+
+class NullAudioSink : public FixedRateAudioSink {
+public:
+    void write(const AudioSample*, int) override
+    {
+    }
+};
+
+
+class WavAudioSink : public FixedRateAudioSink {
+public:
+    WavAudioSink(const char* path)
+        : out_(path, std::ios_base::out | std::ios_base::binary)
+    {
+        if (not out_) {
+            error(*::platform, "failed to open wav file for audio output");
+        }
+        write_header();
+    }
+
+
+    ~WavAudioSink()
+    {
+        // Now that we know how much audio we wrote, fill in the sizes.
+        out_.seekp(0);
+        write_header();
+    }
+
+
+    void write(const AudioSample* samples, int count) override
+    {
+        for (int i = 0; i < count; ++i) {
+            // 8-bit wav files are unsigned.
+            out_.put(static_cast<char>(samples[i] + 128));
+        }
+        data_bytes_ += count;
+    }
+
+private:
+    void put(u32 value, int bytes)
+    {
+        for (int i = 0; i < bytes; ++i) {
+            out_.put(static_cast<char>((value >> (i * 8)) & 0xff));
+        }
+    }
+
+
+    void write_header()
+    {
+        out_.write("RIFF", 4);
+        put(36 + data_bytes_, 4);
+        out_.write("WAVEfmt ", 8);
+        put(16, 4);                // fmt chunk size
+        put(1, 2);                 // pcm
+        put(1, 2);                 // mono
+        put(audio_sample_rate, 4); // sample rate
+        put(audio_sample_rate, 4); // byte rate
+        put(1, 2);                 // block align
+        put(8, 2);                 // bits per sample
+        out_.write("data", 4);
+        put(data_bytes_, 4);
+    }
+
+    std::ofstream out_;
+    u32 data_bytes_ = 0;
+};
+
+
+class SpeakerAudioSink : public AudioSink, public sf::SoundStream {
+public:
+    SpeakerAudioSink()
+    {
+        initialize(1, audio_sample_rate);
+        play();
+    }
+
+
+    ~SpeakerAudioSink()
+    {
+        stop();
+    }
+
+
+    int samples_wanted() override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        const int queued = queue_.size();
+        return queued < latency ? (latency - queued) & ~3 : 0;
+    }
+
+
+    void write(const AudioSample* samples, int count) override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        for (int i = 0; i < count; ++i) {
+            queue_.push_back(samples[i] << 8);
+        }
+    }
+
+private:
+    // About three frames of audio.
+    static const int latency = 800;
+
+
+    // Called by SFML, from its own audio thread.
+    bool onGetData(Chunk& chunk) override
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        chunk_.clear();
+        while (not queue_.empty()) {
+            chunk_.push_back(queue_.front());
+            queue_.pop_front();
+        }
+
+        // If the game falls behind, play a little silence, rather than
+        // returning an empty chunk, which would stop the stream.
+        if (chunk_.empty()) {
+            chunk_.resize(64, 0);
+        }
+
+        chunk.samples = chunk_.data();
+        chunk.sampleCount = chunk_.size();
+
+        return true;
+    }
+
+
+    void onSeek(sf::Time) override
+    {
+    }
+
+
+    std::mutex mutex_;
+    std::deque<s16> queue_;
+    std::vector<s16> chunk_;
+};
+
+
+static SoundContext snd_ctx;
+static std::unique_ptr<AudioSink> audio_sink;
+
+
+static MusicPlayer music_player;
+
+
+static const u32 null_music[2] = {0, 0};
+
+
+static Microseconds audio_mix_time;
+static u32 audio_mixed_samples;
+
+
+static AudioSink& get_audio_sink()
+{
+    if (not audio_sink) {
+        const char* sink = ::platform->get_opt('a');
+
+        if (sink == nullptr or str_cmp(sink, "speaker") == 0) {
+            audio_sink = std::make_unique<SpeakerAudioSink>();
+        } else if (str_cmp(sink, "null") == 0) {
+            audio_sink = std::make_unique<NullAudioSink>();
+        } else {
+            audio_sink = std::make_unique<WavAudioSink>(sink);
+        }
+    }
+
+    return *audio_sink;
+}
+
+
+static void clear_music()
+{
+    snd_ctx.music_track = reinterpret_cast<const AudioSample*>(null_music);
+    snd_ctx.music_track_length = sizeof null_music;
+    snd_ctx.music_track_pos = 0;
+    snd_ctx.music_track_fraction = 0;
+    music_player.stop(snd_ctx);
+}
+
+
+static void audio_update()
+{
+    if (snd_ctx.music_track == nullptr) {
+        clear_music();
+    }
+
+    auto& sink = get_audio_sink();
+
+    const int count = sink.samples_wanted() & ~3;
+    if (count == 0) {
+        return;
+    }
+
+    music_player.fill(snd_ctx);
+
+    std::vector<AudioSample> buffer(count);
+
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    mix_audio_frame(snd_ctx, buffer.data(), count, 1 << 16);
+
+    const auto stop = std::chrono::high_resolution_clock::now();
+
+    audio_mix_time +=
+        std::chrono::duration_cast<std::chrono::microseconds>(stop - start)
+            .count();
+    audio_mixed_samples += count;
+
+    sink.write(buffer.data(), count);
+}
+
+
+static void audio_shutdown()
+{
+    if (audio_mixed_samples) {
+        info(*::platform,
+             ("audio: mixed " + std::to_string(audio_mixed_samples) +
+              " samples in " + std::to_string(audio_mix_time) + "us")
+                 .c_str());
+    }
+
+    // Destroying the wav sink writes the final header.
+    audio_sink.reset();
+}
+
+
 void Platform::Speaker::set_position(const Vec2<Float>& position)
 {
     // sf::Listener::setPosition({position.x, 0, position.y});
@@ -1244,85 +1506,155 @@ void Platform::Speaker::set_position(const Vec2<Float>& position)
 
 Platform::Speaker::Speaker()
 {
-    // TODO...
 }
 
 
-void Platform::Speaker::play_music(const char* name, Microseconds offset)
+void Platform::Speaker::play_note(Note n, Octave o, Channel c)
 {
-    std::string path = resource_path() + ("sounds" PATH_DELIMITER);
-
-    path += "music_";
-    path += name;
-    path += ".ogg";
-
-    if (::platform->data()->music_.openFromFile(path.c_str())) {
-        ::platform->data()->music_.play();
-        ::platform->data()->music_.setLoop(true);
-        ::platform->data()->music_.setPlayingOffset(sf::microseconds(offset));
-        // For desktop releases, we have spatialized sound enabled, such that
-        // the sound effects attenuate based on their distance from the center
-        // of the screen. The music seems too loud by comparison, so I'm
-        // playing the music more quietly than I would on the gameboy advance,
-        // where everthing is mono (there's only one speaker on the device, so
-        // stereo isn't really worth the resources on the gameboy).
-        ::platform->data()->music_.setVolume(70);
-    } else {
-        error(*::platform, "failed to load music file");
+}
+
+
+void Platform::Speaker::play_music(const char* name,
+                                   Microseconds offset,
+                                   const MusicOptions& options)
+{
+    auto music_file = ::platform->fs().get_file(name);
+    if (music_file.data_ == nullptr) {
+        warning(*::platform, "failed to find music file!");
+        return;
+    }
+
+    MusicSource source;
+    if (not source.open(reinterpret_cast<const u8*>(music_file.data_),
+                        music_file.size_)) {
+        warning(*::platform, "empty music file!");
+        return;
+    }
+
+    source.loop_start_ = options.loop_start_ % source.length_;
+    source.seek(offset * 0.016f); // NOTE: because 16kHz
+
+    if (options.queue_ and music_player.playing()) {
+        music_player.queue(source);
+        return;
     }
+
+    music_player.cancel_fade(snd_ctx);
+    music_player.load(source);
+    music_player.start(snd_ctx, options.fade_ * 0.016f);
+}
+
+
+void Platform::Speaker::play_music(const char* name, Microseconds offset)
+{
+    play_music(name, offset, {});
 }
 
 
 void Platform::Speaker::stop_music()
 {
-    ::platform->data()->music_.stop();
+    clear_music();
 }
 
 
-void Platform::Speaker::play_sound(const char* name,
-                                   int priority,
-                                   std::optional<Vec2<Float>> position)
+Platform::Speaker::SoundHandle
+Platform::Speaker::play_sound(const char* name,
+                              int priority,
+                              std::optional<Vec2<Float>> position)
 {
-    (void)priority; // We are not using the priority variable, because we're a
-                    // powerful desktop pc, we can play lots of sounds at once,
-                    // and do not need to evict sounds! Or do we...? I think
-                    // SFML does have a hard upper limit of 256 concurrent audio
-                    // streams, but we'll probably never hit that limit, given
-                    // that the game was originally calibrated for the gameboy
-                    // advance, where I was supporting four concurrent audio
-                    // streams.
+    (void)position; // We mix sounds the same way as the gameboy advance, so we
+                    // don't support spatial audio.
 
-    // std::lock_guard<std::mutex> guard(::platform->data()->audio_lock_);
-    auto& data = ::platform->data()->sound_data_;
-    auto found = data.find(name);
-    if (found not_eq data.end()) {
-        ::platform->data()->sounds_.emplace_back(found->second);
+    auto sound_file = ::platform->fs().get_file(name);
+    if (sound_file.data_ == nullptr) {
+        error(*::platform, (std::string("no sound data for ") + name).c_str());
+        return null_sound;
+    }
 
-        auto& sound = ::platform->data()->sounds_.back();
+    AdpcmStream stream;
+    if (adpcm_open(stream,
+                   reinterpret_cast<const u8*>(sound_file.data_),
+                   sound_file.size_)) {
+        warning(*::platform, "adpcm is only supported for music!");
+        return null_sound;
+    }
 
-        sound.play();
+    const int channel = snd_ctx.pick_channel(priority);
+    if (channel == -1) {
+        return null_sound;
+    }
 
-        // sound.setRelativeToListener(static_cast<bool>(position));
+    const auto data = reinterpret_cast<const AudioSample*>(sound_file.data_);
 
-        // if (position) {
-        //     sound.setAttenuation(0.2f);
-        // } else {
-        //     sound.setAttenuation(0.f);
-        // }
+    return snd_ctx.start(channel, data, sound_file.size_, priority);
+}
 
-        // sound.setMinDistance(160.f);
-        // if (position) {
-        //     sound.setPosition({position->x, 0, position->y});
-        // }
-    } else {
-        error(*::platform, (std::string("no sound data for ") + name).c_str());
+
+bool Platform::Speaker::is_sound_playing(const char* name)
+{
+    auto sound_file = ::platform->fs().get_file(name);
+    if (sound_file.data_) {
+        for (const auto& ch : snd_ctx.channels) {
+            if (ch.data_ ==
+                reinterpret_cast<const AudioSample*>(sound_file.data_)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+
+bool Platform::Speaker::is_playing(SoundHandle sound)
+{
+    return snd_ctx.find(sound) not_eq nullptr;
+}
+
+
+void Platform::Speaker::stop_sound(SoundHandle sound)
+{
+    if (auto ch = snd_ctx.find(sound)) {
+        ch->data_ = nullptr;
     }
 }
 
 
-bool is_sound_playing(const char* name)
+void Platform::Speaker::set_volume(SoundHandle sound, Float volume)
 {
-    return false; // TODO...
+    if (auto ch = snd_ctx.find(sound)) {
+        const int v = volume * audio_full_volume;
+        ch->set_volume(clamp(v, 0, 255), ch->pan_);
+    }
+}
+
+
+void Platform::Speaker::set_pan(SoundHandle sound, Float pan)
+{
+    // The desktop mixer is mono, like the gameboy advance's default mixer.
+    // Remember the pan anyway, for consistency with the gba.
+    if (auto ch = snd_ctx.find(sound)) {
+        const int full = audio_full_volume;
+        const int p = pan * full;
+        ch->set_volume(ch->volume_, clamp(p, -full, full));
+    }
+}
+
+
+Microseconds Platform::Speaker::track_length(const char* name)
+{
+    auto file = ::platform->fs().get_file(name);
+    if (file.data_ == nullptr) {
+        return 0;
+    }
+
+    const auto data = reinterpret_cast<const u8*>(file.data_);
+
+    AdpcmStream stream;
+    if (adpcm_open(stream, data, file.size_)) {
+        return stream.sample_count_ / 0.016f;
+    }
+
+    return file.size_ / 0.016f;
 }
 
 
@@ -1451,8 +1783,15 @@ static const std::unordered_map<std::string, sf::Keyboard::Key> key_lookup{
     {"Y", sf::Keyboard::Y},         {"Z", sf::Keyboard::Z}};
 
 
+static void audio_shutdown();
+static void save_shutdown();
+
+
 Platform::~Platform()
 {
+    audio_shutdown();
+    save_shutdown();
+
     delete data_;
 }
 
@@ -1466,6 +1805,7 @@ static ObjectPool<RcBase<Platform::ScratchBuffer, 100>::ControlBlock, 100>
 
 
 static int scratch_buffers_in_use = 0;
+static int scratch_buffer_highwater = 0;
 
 
 Rc<Platform::ScratchBuffer, 100> Platform::make_scratch_buffer()
@@ -1480,6 +1820,9 @@ Rc<Platform::ScratchBuffer, 100> Platform::make_scratch_buffer()
         Rc<ScratchBuffer, 100>::create(&scratch_buffer_pool, finalizer);
     if (maybe_buffer) {
         ++scratch_buffers_in_use;
+        if (scratch_buffers_in_use > ::scratch_buffer_highwater) {
+            ::scratch_buffer_highwater = scratch_buffers_in_use;
+        }
         return *maybe_buffer;
     } else {
         screen().fade(1.f, ColorConstant::electric_blue);
@@ -1495,6 +1838,12 @@ int Platform::scratch_buffers_remaining()
 }
 
 
+int Platform::scratch_buffer_highwater()
+{
+    return ::scratch_buffer_highwater;
+}
+
+
 static std::optional<DateTime> start_time;
 
 
@@ -1561,29 +1910,118 @@ void Platform::soft_exit()
 }
 
 
-static const char* const save_file_name = "save.dat";
+#include "platform/gba/gba_platform_flashsim.hpp"
+
+
+// The desktop saves through the same journaled save store as the gameboy
+// advance, on top of a simulated flash chip. The chip's contents persist in a
+// file, and at exit we log the write amplification and the latency of the
+// saves.
+static const char* const save_flash_path = "save.flash";
+
+
+static std::unique_ptr<SimulatedFlash> save_flash;
+static std::optional<SaveStore<SimulatedFlashBus>> save_store;
+static u32 save_count;
+static u32 save_bytes;
+
+
+static SaveStore<SimulatedFlashBus>& get_save_store()
+{
+    if (not save_store) {
+        save_flash = std::make_unique<SimulatedFlash>();
+
+        std::ifstream in(save_flash_path,
+                         std::ios_base::in | std::ios_base::binary);
+        if (in) {
+            in.read(reinterpret_cast<char*>(save_flash->data()),
+                    SimulatedFlash::size);
+        }
+
+        save_store.emplace(SimulatedFlashBus{save_flash.get()});
+        save_store->mount();
+    }
+
+    return *save_store;
+}
+
+
+static void save_shutdown()
+{
+    if (not save_flash or save_count == 0) {
+        return;
+    }
+
+    const auto& flash = *save_flash;
+
+    const u64 latency = flash.busy_time();
+
+    info(*::platform,
+         ("save: " + std::to_string(save_count) + " saves of " +
+          std::to_string(save_bytes) + " bytes, programmed " +
+          std::to_string(flash.bytes_programmed_) + " bytes, erased " +
+          std::to_string(flash.sectors_erased_) + " sectors, about " +
+          std::to_string(latency / save_count) + "us per save")
+             .c_str());
+
+    if (flash.stray_writes_) {
+        warning(*::platform, "save: flash received unexpected commands");
+    }
+}
 
 
 bool Platform::write_save_data(const void* data, u32 length)
 {
-    std::ofstream out(save_file_name,
+    auto& store = get_save_store();
+
+    const bool result = store.write(static_cast<const u8*>(data), length);
+
+    std::ofstream out(save_flash_path,
                       std::ios_base::out | std::ios_base::binary);
+    out.write(reinterpret_cast<const char*>(save_flash->data()),
+              SimulatedFlash::size);
 
-    out.write(reinterpret_cast<const char*>(data), length);
+    ++save_count;
+    save_bytes += length;
 
-    return true;
+    return result;
 }
 
 
-bool Platform::read_save_data(void* buffer, u32 data_length)
+void sram_copy(void* dest, const void* src, u32 length)
 {
-    std::ifstream in(save_file_name, std::ios_base::in | std::ios_base::binary);
+    // There's no cartridge ram on the desktop, only ordinary memory.
+    memcpy(dest, src, length);
+}
 
-    if (!in) {
-        return false;
+
+#include "platform/gba/gba_platform_compression.hpp"
+
+
+u32 decompress(const Filesystem::FileData& file, void* dest)
+{
+    const auto compression = compression_of(file);
+    if (compression == Compression::none) {
+        return 0;
+    }
+
+    const auto stream = compressed_stream(file);
+
+    if (dest) {
+        if (compression == Compression::lz77) {
+            lz77_decompress(stream, (u8*)dest);
+        } else {
+            rle_decompress(stream, (u8*)dest);
+        }
     }
 
-    in.read(reinterpret_cast<char*>(buffer), data_length);
+    return decompressed_size(stream);
+}
+
+
+bool Platform::read_save_data(void* buffer, u32 data_length)
+{
+    get_save_store().read(static_cast<u8*>(buffer), data_length);
 
     return true;
 }
@@ -1615,8 +2053,13 @@ void Platform::load_sprite_texture(const char* name)
 }
 
 
+static void clear_tile_animations(Layer layer);
+
+
 void Platform::load_tile0_texture(const char* name)
 {
+    clear_tile_animations(Layer::map_0);
+
     // std::lock_guard<std::mutex> guard(texture_swap_mutex);
     texture_swap_requests.push({TextureSwap::tile0, name});
 }
@@ -1624,6 +2067,8 @@ void Platform::load_tile0_texture(const char* name)
 
 void Platform::load_tile1_texture(const char* name)
 {
+    clear_tile_animations(Layer::map_1);
+
     // std::lock_guard<std::mutex> guard(texture_swap_mutex);
     texture_swap_requests.push({TextureSwap::tile1, name});
 }
@@ -1654,12 +2099,100 @@ void Platform::on_watchdog_timeout(WatchdogCallback callback)
 std::map<Layer, std::map<std::pair<u16, u16>, TileDesc>> tile_layers_;
 
 
+// The gba animates a tile by copying each frame's graphics over the tile in
+// vram. Here, we instead draw the current frame in each cell of the map that
+// holds the tile. tile_layers_ keeps the original tiles, so get_tile() still
+// returns the animated tile, like on the gba.
+struct AnimatedTile {
+    Layer layer_;
+    u16 tile_;
+    u16 start_;
+    u8 length_;
+    u8 rate_;
+    u8 counter_;
+    u8 frame_;
+};
+
+
+static const int max_animated_tiles = 32;
+static std::vector<AnimatedTile> animated_tiles;
+
+
+static void draw_tile_frame(Layer layer, TileDesc tile, TileDesc frame)
+{
+    // std::lock_guard<std::mutex> guard(::tile_swap_mutex);
+    for (auto& kvp : tile_layers_[layer]) {
+        if (kvp.second == tile) {
+            ::tile_swap_requests.push(
+                {layer, kvp.first.first, kvp.first.second, frame});
+        }
+    }
+}
+
+
+static void draw_tile_frame(const AnimatedTile& anim, TileDesc frame)
+{
+    draw_tile_frame(anim.layer_, anim.tile_, frame);
+
+    // The background shares a texture with map_0.
+    if (anim.layer_ == Layer::map_0) {
+        draw_tile_frame(Layer::background, anim.tile_, frame);
+    }
+}
+
+
+// The tile to draw in a cell, in place of the tile that the cell holds.
+static TileDesc animation_frame(Layer layer, TileDesc tile)
+{
+    if (layer == Layer::background) {
+        layer = Layer::map_0;
+    }
+
+    for (auto& anim : animated_tiles) {
+        if (anim.layer_ == layer and anim.tile_ == tile) {
+            return anim.start_ + anim.frame_;
+        }
+    }
+
+    return tile;
+}
+
+
+// Loading a tileset stops the layer's animations, like on the gba, so we put
+// the original tiles back.
+static void clear_tile_animations(Layer layer)
+{
+    for (auto it = animated_tiles.begin(); it not_eq animated_tiles.end();) {
+        if (it->layer_ == layer) {
+            draw_tile_frame(*it, it->tile_);
+            it = animated_tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+
+static void update_animated_tiles()
+{
+    for (auto& anim : animated_tiles) {
+        if (++anim.counter_ >= anim.rate_) {
+            anim.counter_ = 0;
+            if (++anim.frame_ == anim.length_) {
+                anim.frame_ = 0;
+            }
+            draw_tile_frame(anim, anim.start_ + anim.frame_);
+        }
+    }
+}
+
+
 void Platform::set_tile(Layer layer, u16 x, u16 y, TileDesc val)
 {
     tile_layers_[layer][{x, y}] = val;
 
     // std::lock_guard<std::mutex> guard(::tile_swap_mutex);
-    ::tile_swap_requests.push({layer, x, y, val});
+    ::tile_swap_requests.push({layer, x, y, animation_frame(layer, val)});
 }
 
 
@@ -1677,6 +2210,50 @@ TileDesc Platform::get_tile(Layer layer, u16 x, u16 y)
 }
 
 
+bool Platform::animate_tile(Layer layer, u16 tile, u16 start, u8 len, u8 rate)
+{
+    if (layer == Layer::overlay) {
+        return false;
+    }
+
+    // The background shares a texture with map_0.
+    if (layer == Layer::background) {
+        layer = Layer::map_0;
+    }
+
+    for (auto it = animated_tiles.begin(); it not_eq animated_tiles.end();
+         ++it) {
+        if (it->layer_ == layer and it->tile_ == tile) {
+            if (len == 0) {
+                draw_tile_frame(*it, tile);
+                animated_tiles.erase(it);
+            } else {
+                it->start_ = start;
+                it->length_ = len;
+                it->rate_ = rate;
+                it->counter_ = 0;
+                it->frame_ = 0;
+                draw_tile_frame(*it, start);
+            }
+            return true;
+        }
+    }
+
+    if (len == 0) {
+        return true;
+    }
+
+    if (animated_tiles.size() == max_animated_tiles) {
+        return false;
+    }
+
+    animated_tiles.push_back({layer, tile, start, len, rate, 0, 0});
+    draw_tile_frame(animated_tiles.back(), start);
+
+    return true;
+}
+
+
 void Platform::fill_overlay(u16 tile_desc)
 {
     for (auto& kvp : tile_layers_[Layer::overlay]) {
@@ -1790,6 +2367,8 @@ const char* Platform::get_opt(char opt)
             op.add<popl::Switch>("h", "help", "produce help message");
         auto eval_option =
             op.add<popl::Value<std::string>>("e", "eval", "evaluate lisp");
+        auto audio_option = op.add<popl::Value<std::string>>(
+            "a", "audio", "audio sink: speaker, null, or a .wav file");
 
         op.parse(::argc, ::argv);
 
@@ -1800,6 +2379,13 @@ const char* Platform::get_opt(char opt)
                 return eval_result.c_str();
             }
             break;
+
+        case 'a':
+            if (audio_option->is_set()) {
+                static std::string audio_result = audio_option->value();
+                return audio_result.c_str();
+            }
+            break;
         }
     } catch (...) {
         // ... TODO ...
@@ -7,7 +7,9 @@
 #define REG_BASE 0x04000000
 #define REG_DISPCNT *(u32*)0x4000000
 #define	REG_DISPSTAT	*((volatile u16 *)(REG_BASE + 0x04))
+#define REG_VCOUNT *((volatile u16*)(REG_BASE + 0x06))
 #define MODE_0 0x0
+#define OBJ_HBLANK_FREE 0x20
 #define OBJ_MAP_1D 0x40
 #define OBJ_ENABLE 0x1000
 #define REG_WAITCNT *(u16*)0x4000204
@@ -73,6 +75,7 @@ typedef u16 ScreenBlock[1024];
 #define ATTR0_TALL OBJ_SHAPE(2)
 #define ATTR0_WIDE OBJ_SHAPE(1)
 #define ATTR0_BLEND 0x0400
+#define ATTR1_SIZE_8 (0 << 14)
 #define ATTR1_SIZE_16 (1 << 14)
 #define ATTR1_SIZE_32 (2 << 14)
 #define ATTR1_SIZE_64 (3 << 14)
@@ -331,9 +334,17 @@ typedef u16 ScreenBlock[1024];
 
 #define REG_SOUNDCNT_H *(volatile u16*)0x4000082 //Direct sound control
 #define REG_SOUNDCNT_X *(volatile u16*)0x4000084 //Extended sound control
-#define REG_DMA1SAD *(u32*)0x40000BC             //DMA1 Source Address
-#define REG_DMA1DAD *(u32*)0x40000C0             //DMA1 Desination Address
-#define REG_DMA1CNT_H *(u16*)0x40000C6           //DMA1 Control High Value
+#define REG_DMA1SAD *(volatile u32*)0x40000BC    //DMA1 Source Address
+#define REG_DMA1DAD *(volatile u32*)0x40000C0    //DMA1 Desination Address
+#define REG_DMA1CNT_H *(volatile u16*)0x40000C6  //DMA1 Control High Value
+#define REG_DMA2SAD *(volatile u32*)0x40000C8    //DMA2 Source Address
+#define REG_DMA2DAD *(volatile u32*)0x40000CC    //DMA2 Desination Address
+#define REG_DMA2CNT_H *(volatile u16*)0x40000D2  //DMA2 Control High Value
+#define REG_DMA3SAD *(volatile u32*)0x40000D4    //DMA3 Source Address
+#define REG_DMA3DAD *(volatile u32*)0x40000D8    //DMA3 Desination Address
+#define REG_DMA3CNT *(volatile u32*)0x40000DC    //DMA3 Control (count + flags)
+#define DMA_32 0x04000000                        //Transfer words, not halfwords
+#define DMA_ENABLE 0x80000000
 #define REG_TM1CNT_L *(u16*)0x4000104            //Timer 2 count value
 #define REG_TM1CNT_H *(u16*)0x4000106            //Timer 2 control
 #define REG_TM0CNT_L *(u16*)0x4000100            //Timer 0 count value
@@ -610,6 +621,26 @@ static inline u32 BiosCheckSum() {
 	return result;
 }
 
+//---------------------------------------------------------------------------------
+// Decompression functions
+//---------------------------------------------------------------------------------
+/*! \def DecompressCall(Number, Source, Dest)
+    \brief helper macro to call a bios decompression function.
+
+		The source data must be word-aligned. The Wram functions write a byte at
+		a time, the Vram functions write 16 bits at a time.
+*/
+#if	defined	( __thumb__ )
+#define	DecompressCall(Number, Source, Dest)	__asm volatile ("mov r0, %0\nmov r1, %1\nSWI	"#Number"\n" :: "r"(Source), "r"(Dest) : "r0", "r1", "r2", "r3", "memory")
+#else
+#define	DecompressCall(Number, Source, Dest)	__asm volatile ("mov r0, %0\nmov r1, %1\nSWI	"#Number" << 16\n" :: "r"(Source), "r"(Dest) : "r0", "r1", "r2", "r3", "memory")
+#endif
+
+static inline void LZ77UnCompWram(const void *source, void *dest)	{ DecompressCall(0x11, source, dest); }
+static inline void LZ77UnCompVram(const void *source, void *dest)	{ DecompressCall(0x12, source, dest); }
+static inline void RLUnCompWram(const void *source, void *dest)	{ DecompressCall(0x14, source, dest); }
+static inline void RLUnCompVram(const void *source, void *dest)	{ DecompressCall(0x15, source, dest); }
+
 //---------------------------------------------------------------------------------
 // Math functions
 //---------------------------------------------------------------------------------
@@ -25,3 +25,82 @@ void cartridge_interrupt_handler()
 {
     Stop();
 }
+
+
+#include "gba_platform_oamrewrite.hpp"
+
+
+// When multiplexing sprites, we need to rewrite object attributes as soon as
+// possible after a scanline finishes, so the handler needs to be fast, and
+// needs to live in IWRAM.
+IWRAM_CODE
+void oam_rewrite_hblank_isr()
+{
+    const u16 line = REG_VCOUNT;
+
+    // The hblank interrupt also fires during the vblank period, when the
+    // cursor may point to the next frame's rewrites.
+    if (line >= 160) {
+        return;
+    }
+
+    auto rw = oam_rewrite_cursor;
+    auto oam = (volatile u16*)0x07000000;
+
+    while (rw->line_ <= line) {
+        auto oa = oam + rw->slot_ * 4;
+        oa[0] = rw->attr_[0];
+        oa[1] = rw->attr_[1];
+        oa[2] = rw->attr_[2];
+        ++rw;
+    }
+
+    oam_rewrite_cursor = rw;
+}
+
+
+#include "gba_platform_mixer.hpp"
+
+
+// The frame mixer runs once per vblank, and mixes a few hundred samples for
+// each active sound, so it's worth running as arm code from IWRAM.
+IWRAM_CODE
+void audio_mix_frame(SoundContext& ctx, AudioSample* out)
+{
+    mix_audio_frame(ctx, out, mixer_frame_samples, mixer_resample_step);
+}
+
+
+IWRAM_CODE
+void audio_mix_frame_stereo(SoundContext& ctx,
+                            AudioSample* left,
+                            AudioSample* right)
+{
+    mix_audio_frame_stereo(
+        ctx, left, right, mixer_frame_samples, mixer_resample_step);
+}
+
+
+#include "gba_platform_music.hpp"
+
+
+// Filling the music ring buffers runs once per vblank, and decodes a frame's
+// worth of music samples.
+IWRAM_CODE
+void audio_fill_music(MusicPlayer& player, SoundContext& ctx)
+{
+    player.fill(ctx);
+}
+
+
+#include "gba_platform_sram.hpp"
+
+
+// Each access to sram costs several wait states anyway, but running the copy
+// loop from IWRAM at least means that we don't also wait on the cartridge bus
+// for every instruction fetch.
+IWRAM_CODE
+void sram_block_copy(u8* dest, const u8* src, u32 length)
+{
+    sram_copy_bytes(dest, src, length);
+}
@@ -11,6 +11,7 @@
 
 #include "bulkAllocator.hpp"
 #include "graphics/overlay.hpp"
+#include "graphics/spriteMultiplexer.hpp"
 #include "images.cpp"
 #include "number/random.hpp"
 #include "platform/platform.hpp"
@@ -24,6 +25,9 @@ void english__to_string(int num, char* buffer, int base);
 
 
 #include "gba.h"
+#include "gba_platform_compression.hpp"
+#include "gba_platform_glyphtable.hpp"
+#include "gba_platform_oamrewrite.hpp"
 
 
 struct BiosVersion {
@@ -49,9 +53,23 @@ Platform::DeviceName Platform::device_name() const
 }
 
 
+static void enable_sprite_multiplexer(bool enabled);
+static void enable_sprite_streaming(bool enabled);
+static void enable_audio_frame_mixer(bool enabled);
+static void enable_stereo_audio(bool enabled);
+
+
 void Platform::enable_feature(const char* feature_name, bool enabled)
 {
-    // ...
+    if (str_cmp(feature_name, "sprite_multiplexer") == 0) {
+        enable_sprite_multiplexer(enabled);
+    } else if (str_cmp(feature_name, "sprite_streaming") == 0) {
+        enable_sprite_streaming(enabled);
+    } else if (str_cmp(feature_name, "audio_frame_mixer") == 0) {
+        enable_audio_frame_mixer(enabled);
+    } else if (str_cmp(feature_name, "stereo_audio") == 0) {
+        enable_stereo_audio(enabled);
+    }
 }
 
 
@@ -123,7 +141,9 @@ void start(Platform&);
 static Platform* platform;
 
 
-[[gnu::used]] alignas(4) static EWRAM_DATA u8 heap[240000];
+// NOTE: The engine's entity pool also lives in EWRAM, so the heap gives up a
+// few kilobytes to make room for it.
+[[gnu::used]] alignas(4) static EWRAM_DATA u8 heap[232000];
 
 void* UMM_MALLOC_CFG_HEAP_ADDR = &heap;
 uint32_t UMM_MALLOC_CFG_HEAP_SIZE = sizeof heap;
@@ -463,6 +483,35 @@ static u32 last_oam_write_index = 0;
 static u32 oam_write_index = 0;
 
 
+// When the sprite multiplexer is enabled, Screen::draw() hands sprites to the
+// multiplexer instead of writing them to the OAM back buffer. Screen::display()
+// then schedules the sprites, and publishes a frame's worth of initial object
+// attributes and hblank rewrites, which the vblank handler swaps in.
+struct MultiplexedFrame {
+    ObjectAttributes initial_[oam_count];
+    OamRewrite rewrites_[SpriteMultiplexer::capacity + 1];
+};
+
+
+struct MultiplexerState {
+    SpriteMultiplexer sprites_;
+    MultiplexedFrame frames_[2];
+};
+
+
+// The multiplexer needs about thirteen kilobytes, which we allocate from the
+// heap when a game turns the feature on, so that games that do not need more
+// than 128 sprites do not pay for it.
+static MultiplexerState* multiplexer = nullptr;
+static volatile int multiplexed_front = 0;
+
+
+const OamRewrite* volatile oam_rewrite_cursor;
+
+
+__attribute__((section(".iwram"), long_call)) void oam_rewrite_hblank_isr();
+
+
 Color real_color(ColorConstant k)
 {
     switch (k) {
@@ -627,6 +676,225 @@ static PaletteBank color_mix(ColorConstant k, u8 amount)
 }
 
 
+// Object attribute shape and size bits for each Sprite::Size, along with the
+// number of 8x8 tiles that a sprite of each size occupies in the spritesheet.
+static const struct ObjectShape {
+    u16 attr0_;
+    u16 attr1_;
+    u8 tiles_;
+} object_shapes[Sprite::size_count] = {
+    {ATTR0_SQUARE, ATTR1_SIZE_16, 4},  // w16_h16
+    {ATTR0_SQUARE, ATTR1_SIZE_8, 1},   // w8_h8
+    {ATTR0_SQUARE, ATTR1_SIZE_32, 16}, // w32_h32
+    {ATTR0_SQUARE, ATTR1_SIZE_64, 64}, // w64_h64
+    {ATTR0_WIDE, ATTR1_SIZE_8, 2},     // w16_h8
+    {ATTR0_WIDE, ATTR1_SIZE_16, 4},    // w32_h8
+    {ATTR0_WIDE, ATTR1_SIZE_32, 8},    // w32_h16
+    {ATTR0_WIDE, ATTR1_SIZE_64, 32},   // w64_h32
+    {ATTR0_TALL, ATTR1_SIZE_8, 2},     // w8_h16
+    {ATTR0_TALL, ATTR1_SIZE_16, 4},    // w8_h32
+    {ATTR0_TALL, ATTR1_SIZE_32, 8},    // w16_h32
+    {ATTR0_TALL, ATTR1_SIZE_64, 32},   // w32_h64
+};
+
+
+// In sprite streaming mode, the spritesheet stays in ROM, and we treat OBJ VRAM
+// as a cache of 16x16 frames. Screen::draw() looks up each frame, evicting the
+// least recently used slot on a miss, and display() copies the missed frames
+// into VRAM.
+static struct SpriteCache {
+    static constexpr int slot_count = (1024 - 2) / 4;
+    static constexpr u8 list_head = slot_count;
+    static constexpr int table_size = 512;
+    static constexpr u16 empty = 0xffff;
+    static constexpr int bytes_per_frame = 128;
+
+    bool enabled_ = false;
+
+    const u8* rom_tiles_ = nullptr;
+    u32 rom_frame_count_ = 0;
+
+    // Open addressing table, mapping frame indices to slots.
+    u16 table_keys_[table_size];
+    u8 table_slots_[table_size];
+
+    u16 slot_frame_[slot_count];
+    u32 slot_used_[slot_count];
+
+    // Circular doubly-linked list of slots, most recently used first. The
+    // extra node serves as the list head.
+    u8 prev_[slot_count + 1];
+    u8 next_[slot_count + 1];
+
+    u8 uploads_[slot_count];
+    int upload_count_ = 0;
+
+    u32 frame_ = 1;
+
+    Platform::Screen::SpriteCacheStats stats_;
+
+
+    void reset()
+    {
+        for (auto& key : table_keys_) {
+            key = empty;
+        }
+
+        for (int i = 0; i < slot_count; ++i) {
+            slot_frame_[i] = empty;
+            slot_used_[i] = 0;
+        }
+
+        for (int i = 0; i < slot_count + 1; ++i) {
+            next_[i] = (i + 1) % (slot_count + 1);
+            prev_[i] = (i + slot_count) % (slot_count + 1);
+        }
+
+        upload_count_ = 0;
+        stats_ = {};
+    }
+
+
+    static int hash(u16 frame)
+    {
+        return (frame * 37) & (table_size - 1);
+    }
+
+
+    int find(u16 frame) const
+    {
+        for (int i = hash(frame);; i = (i + 1) & (table_size - 1)) {
+            if (table_keys_[i] == frame) {
+                return i;
+            } else if (table_keys_[i] == empty) {
+                return -1;
+            }
+        }
+    }
+
+
+    void insert(u16 frame, u8 slot)
+    {
+        int i = hash(frame);
+        while (table_keys_[i] not_eq empty) {
+            i = (i + 1) & (table_size - 1);
+        }
+        table_keys_[i] = frame;
+        table_slots_[i] = slot;
+    }
+
+
+    // Backward-shift deletion, so that we never need tombstones.
+    void erase(int i)
+    {
+        int j = i;
+        while (true) {
+            j = (j + 1) & (table_size - 1);
+            if (table_keys_[j] == empty) {
+                break;
+            }
+            const int k = hash(table_keys_[j]);
+            const bool movable =
+                (j > i) ? (k <= i or k > j) : (k <= i and k > j);
+            if (movable) {
+                table_keys_[i] = table_keys_[j];
+                table_slots_[i] = table_slots_[j];
+                i = j;
+            }
+        }
+        table_keys_[i] = empty;
+    }
+
+
+    void touch(u8 slot)
+    {
+        next_[prev_[slot]] = next_[slot];
+        prev_[next_[slot]] = prev_[slot];
+
+        next_[slot] = next_[list_head];
+        prev_[slot] = list_head;
+        prev_[next_[list_head]] = slot;
+        next_[list_head] = slot;
+
+        slot_used_[slot] = frame_;
+    }
+
+
+    // Returns the vram slot holding a frame, or -1 if every slot is in use by
+    // the current frame.
+    int get(u16 frame)
+    {
+        if (UNLIKELY(frame >= rom_frame_count_)) {
+            return -1;
+        }
+
+        if (const int i = find(frame); i not_eq -1) {
+            const auto slot = table_slots_[i];
+            if (slot_used_[slot] not_eq frame_) {
+                touch(slot);
+            }
+            ++stats_.hits_;
+            return slot;
+        }
+
+        const u8 victim = prev_[list_head];
+        if (slot_used_[victim] == frame_) {
+            return -1;
+        }
+
+        if (slot_frame_[victim] not_eq empty) {
+            erase(find(slot_frame_[victim]));
+        }
+
+        slot_frame_[victim] = frame;
+        insert(frame, victim);
+        touch(victim);
+
+        uploads_[upload_count_++] = victim;
+        ++stats_.misses_;
+
+        return victim;
+    }
+
+
+    void upload()
+    {
+        for (int i = 0; i < upload_count_; ++i) {
+            const auto slot = uploads_[i];
+
+            // NOTE: the bundle only aligns files to halfwords, so we can't
+            // use memcpy32 here. memcpy16 copies by word when it can.
+            memcpy16((u8*)MEM_TILE[4] + (2 + slot * 4) * 32,
+                     rom_tiles_ + slot_frame_[slot] * bytes_per_frame,
+                     bytes_per_frame / 2);
+        }
+
+        stats_.uploads_ = upload_count_;
+        upload_count_ = 0;
+        ++frame_;
+    }
+
+} sprite_cache;
+
+
+Platform::Screen::SpriteCacheStats Platform::Screen::sprite_cache_stats() const
+{
+    return sprite_cache.stats_;
+}
+
+
+std::optional<Platform::FailureReason>
+Platform::Screen::check_sprite_size(Sprite::Size size) const
+{
+    if (sprite_cache.enabled_ and size not_eq Sprite::Size::w16_h16) {
+        Platform::FailureReason r;
+        r += "sprite streaming only draws 16x16 sprites";
+        return r;
+    }
+    return {};
+}
+
+
 void Platform::Screen::draw(const Sprite& spr)
 {
     if (UNLIKELY(spr.get_alpha() == Sprite::Alpha::transparent)) {
@@ -647,8 +915,11 @@ void Platform::Screen::draw(const Sprite& spr)
         }
     }();
 
+    const auto& shape = object_shapes[spr.get_size()];
+    const auto dimensions = Sprite::dimensions(spr.get_size());
+
     auto draw_sprite = [&](int tex_off, int x_off, int scale) {
-        if (UNLIKELY(oam_write_index == oam_count)) {
+        if (UNLIKELY(oam_write_index == oam_count and not multiplexer)) {
             return;
         }
         const auto position =
@@ -657,18 +928,50 @@ void Platform::Screen::draw(const Sprite& spr)
         const auto view_center = view_.get_center().cast<s32>();
 
         auto abs_position = position - view_center;
-        if (abs_position.x < -16 or abs_position.x > 256 or
-            abs_position.y < -16 or abs_position.y > 176) {
+        if (abs_position.x < -dimensions.x or abs_position.x > 256 or
+            abs_position.y < -dimensions.y or abs_position.y > 176) {
+            return;
+        }
+
+        int cache_slot = 0;
+        if (sprite_cache.enabled_) {
+            // We only stream 16x16 frames. The engine rejects other sizes with
+            // check_sprite_size(), but an entity may still carry an older size
+            // from before the script enabled streaming.
+            if (spr.get_size() not_eq Sprite::Size::w16_h16) {
+                return;
+            }
+            cache_slot = sprite_cache.get(spr.get_texture_index());
+            if (cache_slot == -1) {
+                return;
+            }
+        }
+
+        const int tile = sprite_cache.enabled_
+                             ? 2 + cache_slot * 4
+                             : 2 + spr.get_texture_index() * scale + tex_off;
+
+        // Sprite memory holds 1024 tiles, and the tile number only has ten
+        // bits in attribute 2. A larger number would spill into the priority
+        // and palette bits, so skip frames that run past the end of sprite
+        // memory, e.g. a 64x64 sprite at index 16.
+        if (UNLIKELY(tile + scale > 1024)) {
             return;
         }
 
-        auto oa = object_attribute_back_buffer + oam_write_index;
+        ObjectAttributes multiplexed;
+        auto oa = multiplexer
+                      ? &multiplexed
+                      : object_attribute_back_buffer + oam_write_index;
+
+        int height = dimensions.y;
+
         if (spr.get_alpha() not_eq Sprite::Alpha::translucent) {
-            oa->attribute_0 = ATTR0_COLOR_16 | ATTR0_SQUARE;
+            oa->attribute_0 = ATTR0_COLOR_16 | shape.attr0_;
         } else {
-            oa->attribute_0 = ATTR0_COLOR_16 | ATTR0_SQUARE | ATTR0_BLEND;
+            oa->attribute_0 = ATTR0_COLOR_16 | shape.attr0_ | ATTR0_BLEND;
         }
-        oa->attribute_1 = ATTR1_SIZE_16; // clear attr1
+        oa->attribute_1 = shape.attr1_; // clear attr1
 
         oa->attribute_0 &= (0xff00 & ~((1 << 8) | (1 << 9))); // clear attr0
 
@@ -691,8 +994,9 @@ void Platform::Screen::draw(const Sprite& spr)
                 oa->attribute_0 |= 1 << 8;
                 oa->attribute_0 |= 1 << 9;
 
-                abs_position.x -= 8;
-                abs_position.y -= 16;
+                abs_position.x -= dimensions.x / 2;
+                abs_position.y -= dimensions.y;
+                height *= 2;
 
                 oa->attribute_1 |= affine_transform_write_index << 9;
 
@@ -713,17 +1017,22 @@ void Platform::Screen::draw(const Sprite& spr)
         }
 
         oa->attribute_1 |= (abs_position.x + x_off) & 0x01ff;
-        oa->attribute_2 = 2 + spr.get_texture_index() * scale + tex_off;
+        oa->attribute_2 = tile;
         oa->attribute_2 |= pb;
         oa->attribute_2 |= ATTR2_PRIORITY(::sprite_priority);
-        oam_write_index += 1;
+
+        if (multiplexer) {
+            multiplexer->sprites_.push({oa->attribute_0,
+                                        oa->attribute_1,
+                                        oa->attribute_2,
+                                        s16(abs_position.y),
+                                        u16(height)});
+        } else {
+            oam_write_index += 1;
+        }
     };
 
-    switch (spr.get_size()) {
-    case Sprite::Size::w16_h16:
-        draw_sprite(0, 0, 4);
-        break;
-    }
+    draw_sprite(0, 0, shape.tiles_);
 }
 
 
@@ -793,7 +1102,60 @@ static void key_standby_isr()
 
 
 static ScreenBlock overlay_back_buffer alignas(u32);
-static bool overlay_back_buffer_changed = false;
+
+// One bit per row of the overlay back buffer. We only copy the rows that
+// changed, because most games only update a few hud tiles per frame.
+static u32 overlay_dirty_rows = 0;
+static u32 overlay_copy_bytes = 0;
+
+
+static void copy_overlay_rows()
+{
+    // DMA halts the cpu, so we don't want to use it while a multiplayer
+    // session is running (see the note above audio_update_isr). A hud update
+    // only touches a few rows, so the cpu copy is not much slower anyway.
+    const bool use_dma = not ::platform->network_peer().is_connected();
+
+    const u32 rows = overlay_dirty_rows;
+    overlay_dirty_rows = 0;
+    overlay_copy_bytes = 0;
+
+    int y = 0;
+    while (y < 32) {
+        if (not(rows & (1u << y))) {
+            ++y;
+            continue;
+        }
+
+        // Merge adjacent dirty rows into a single copy.
+        int end = y + 1;
+        while (end < 32 and (rows & (1 << end))) {
+            ++end;
+        }
+
+        const auto src = &overlay_back_buffer[y * 32];
+        const auto dest = &MEM_SCREENBLOCKS[sbb_overlay_tiles][y * 32];
+        const u32 words = ((end - y) * 32 * sizeof(u16)) / 4;
+
+        if (use_dma) {
+            REG_DMA3SAD = (intptr_t)src;
+            REG_DMA3DAD = (intptr_t)dest;
+            REG_DMA3CNT = DMA_ENABLE | DMA_32 | words;
+        } else {
+            memcpy32(dest, src, words);
+        }
+
+        overlay_copy_bytes += words * 4;
+
+        y = end;
+    }
+}
+
+
+u32 Platform::Screen::overlay_copy_bytes() const
+{
+    return ::overlay_copy_bytes;
+}
 
 
 u16 t1_scroll_x = 0;
@@ -830,6 +1192,109 @@ void Platform::scroll(Layer layer, u16 xscroll, u16 yscroll)
 }
 
 
+static void update_animated_tiles();
+static void flush_glyph_uploads();
+
+
+// Restore the front frame's initial set of objects, and point the hblank
+// handler at the first of the frame's rewrites.
+static void restore_multiplexed_frame()
+{
+    auto& frame = multiplexer->frames_[multiplexed_front];
+
+    memcpy32(object_attribute_memory,
+             frame.initial_,
+             (sizeof frame.initial_) / 4);
+
+    oam_rewrite_cursor = frame.rewrites_;
+}
+
+
+// Called from display(), during the vblank, like the copy to oam in the
+// non-multiplexed path, so that the sprites change in the same frame as the
+// scroll registers.
+static void publish_multiplexed_frame()
+{
+    // The vblank handler only ever reads the front frame.
+    auto& frame = multiplexer->frames_[not multiplexed_front];
+
+    memcpy32(frame.initial_,
+             object_attribute_back_buffer,
+             (sizeof object_attribute_back_buffer) / 4);
+
+    const int count = multiplexer->sprites_.rewrite_count();
+    for (int i = 0; i < count; ++i) {
+        const auto& rw = multiplexer->sprites_.rewrite(i);
+        const auto& mo = multiplexer->sprites_.get(rw.object_);
+        auto& out = frame.rewrites_[i];
+        out.line_ = rw.line_;
+        out.slot_ = rw.slot_;
+        out.attr_[0] = mo.attr0_;
+        out.attr_[1] = mo.attr1_;
+        out.attr_[2] = mo.attr2_;
+    }
+    frame.rewrites_[count].line_ = oam_rewrite_sentinel_line;
+
+    multiplexer->sprites_.clear();
+
+    // If the vblank handler interrupts us after the swap, it restores the new
+    // frame, same as we do.
+    multiplexed_front = not multiplexed_front;
+    restore_multiplexed_frame();
+}
+
+
+static void multiplexer_vblank()
+{
+    // The hblank handler rewrote some of the objects during the last frame, so
+    // we need to restore the initial set every time.
+    restore_multiplexed_frame();
+}
+
+
+static void enable_sprite_multiplexer(bool enabled)
+{
+    if (enabled == (multiplexer not_eq nullptr)) {
+        return;
+    }
+
+    if (enabled) {
+        auto mem = umm_malloc(sizeof(MultiplexerState));
+        if (mem == nullptr) {
+            error(*::platform, "not enough memory for sprite multiplexer");
+            return;
+        }
+        multiplexer = new (mem) MultiplexerState();
+
+        // Until the first multiplexed frame comes in, keep showing whatever
+        // is on screen now.
+        auto& frame = multiplexer->frames_[multiplexed_front];
+        memcpy32(frame.initial_,
+                 object_attribute_back_buffer,
+                 (sizeof object_attribute_back_buffer) / 4);
+        frame.rewrites_[0].line_ = oam_rewrite_sentinel_line;
+        oam_rewrite_cursor = frame.rewrites_;
+
+        multiplexer->sprites_.clear();
+
+        // Object attribute memory is normally locked during hblank.
+        REG_DISPCNT = REG_DISPCNT | OBJ_HBLANK_FREE;
+
+        irqSet(IRQ_HBLANK, oam_rewrite_hblank_isr);
+        irqEnable(IRQ_HBLANK);
+    } else {
+        irqDisable(IRQ_HBLANK);
+
+        REG_DISPCNT = REG_DISPCNT & ~OBJ_HBLANK_FREE;
+
+        auto state = multiplexer;
+        multiplexer = nullptr;
+        state->~MultiplexerState();
+        umm_free(state);
+    }
+}
+
+
 void Platform::Screen::display()
 {
     // platform->stopwatch().start();
@@ -842,12 +1307,28 @@ void Platform::Screen::display()
         }
     }
 
-    if (overlay_back_buffer_changed) {
-        overlay_back_buffer_changed = false;
+    flush_glyph_uploads();
+
+    if (overlay_dirty_rows) {
+        copy_overlay_rows();
+    } else {
+        ::overlay_copy_bytes = 0;
+    }
+
+    if (multiplexer) {
+        multiplexer->sprites_.schedule();
 
-        memcpy32(MEM_SCREENBLOCKS[sbb_overlay_tiles],
-                 overlay_back_buffer,
-                 (sizeof overlay_back_buffer) / 4);
+        for (u32 i = 0; i < oam_count; ++i) {
+            const auto obj = multiplexer->sprites_.initial(i);
+            if (obj not_eq SpriteMultiplexer::null_object) {
+                const auto& mo = multiplexer->sprites_.get(obj);
+                auto& oa = object_attribute_back_buffer[i];
+                oa.attribute_0 = mo.attr0_;
+                oa.attribute_1 = mo.attr1_;
+                oa.attribute_2 = mo.attr2_;
+                oam_write_index = i + 1;
+            }
+        }
     }
 
     for (u32 i = oam_write_index; i < last_oam_write_index; ++i) {
@@ -873,9 +1354,19 @@ void Platform::Screen::display()
     // would see better performance when writing directly to OAM, rather than
     // doing a copy later, but I did not notice any performance difference when
     // adding a back buffer.
-    memcpy32(object_attribute_memory,
-             object_attribute_back_buffer,
-             (sizeof object_attribute_back_buffer) / 4);
+    if (sprite_cache.enabled_) {
+        sprite_cache.upload();
+    }
+
+    update_animated_tiles();
+
+    if (multiplexer) {
+        publish_multiplexed_frame();
+    } else {
+        memcpy32(object_attribute_memory,
+                 object_attribute_back_buffer,
+                 (sizeof object_attribute_back_buffer) / 4);
+    }
 
     last_affine_transform_write_index = affine_transform_write_index;
     affine_transform_write_index = 0;
@@ -943,9 +1434,36 @@ static const TextureData* current_tilesheet0 = &tile_textures[0];
 static const TextureData* current_tilesheet1 = &tile_textures[1];
 static const TextureData* current_overlay_texture = &overlay_textures[1];
 
+// Tilesets may use up to four palettes. Each tile layer owns four background
+// palette banks: the layer's original bank, plus three of the banks that the
+// engine leaves unused (the overlay uses bank 1, and custom text colors use
+// banks 3-6). Layer 3 shares layer 2's tileset, and so also its banks.
+static constexpr int tile_layer_palettes = 4;
+static const PaletteBank tile0_banks[tile_layer_palettes] = {0, 7, 8, 9};
+static const PaletteBank tile1_banks[tile_layer_palettes] = {2, 10, 11, 12};
+static int tile0_palette_count = 1;
+static int tile1_palette_count = 1;
+
+
+// The palette used by each tile of a layer's tileset, filled in when we load
+// the tileset, so that set_tile() picks the right palette bank with a table
+// lookup. A tile layer holds fewer than 512 tiles, see
+// validate_tilemap_texture_size().
+static constexpr int tile_palette_table_size = 512;
+static EWRAM_DATA u8 tile0_palettes[tile_palette_table_size];
+static EWRAM_DATA u8 tile1_palettes[tile_palette_table_size];
+
+
+static u16 tile_palbank(const PaletteBank* banks, const u8* palettes, u16 tile)
+{
+    // The mask also strips the flip bits from the screen entry.
+    return SE_PALBANK(banks[palettes[tile & (tile_palette_table_size - 1)]]);
+}
+
+
 static u16 sprite_palette[16];
-static u16 tilesheet_0_palette[16];
-static u16 tilesheet_1_palette[16];
+static u16 tilesheet_0_palette[16 * tile_layer_palettes];
+static u16 tilesheet_1_palette[16 * tile_layer_palettes];
 static u16 overlay_palette[16];
 
 
@@ -964,12 +1482,14 @@ Contrast Platform::Screen::get_contrast() const
 }
 
 
-static void
-init_palette(const TextureData* td, u16* palette, bool skip_contrast)
+static void init_palette(const TextureData* td,
+                         u16* palette,
+                         bool skip_contrast,
+                         int count = 16)
 {
     const auto adj_cr = contrast + base_contrast;
 
-    for (int i = 0; i < 16; ++i) {
+    for (int i = 0; i < count; ++i) {
         if (not skip_contrast and adj_cr not_eq 0) {
             const Float f = (259.f * (adj_cr + 255)) / (255 * (259 - adj_cr));
             const auto c =
@@ -996,6 +1516,23 @@ init_palette(const TextureData* td, u16* palette, bool skip_contrast)
 }
 
 
+// Copy a tile layer's palettes into their palette banks, blended with the
+// current screen fade color.
+static void write_tile_palettes(const u16* palette,
+                                const PaletteBank* banks,
+                                int count,
+                                const Color& c,
+                                u8 amt)
+{
+    for (int p = 0; p < count; ++p) {
+        for (int i = 0; i < 16; ++i) {
+            auto from = Color::from_bgr_hex_555(palette[p * 16 + i]);
+            MEM_BG_PALETTE[banks[p] * 16 + i] = blend(from, c, amt);
+        }
+    }
+}
+
+
 void Platform::Screen::enable_night_mode(bool enabled)
 {
     ::night_mode = enabled;
@@ -1007,8 +1544,14 @@ void Platform::Screen::enable_night_mode(bool enabled)
     }
 
     init_palette(current_spritesheet, sprite_palette, false);
-    init_palette(current_tilesheet0, tilesheet_0_palette, false);
-    init_palette(current_tilesheet1, tilesheet_1_palette, false);
+    init_palette(current_tilesheet0,
+                 tilesheet_0_palette,
+                 false,
+                 16 * tile0_palette_count);
+    init_palette(current_tilesheet1,
+                 tilesheet_1_palette,
+                 false,
+                 16 * tile1_palette_count);
     init_palette(current_overlay_texture, overlay_palette, true);
 
     // TODO: Edit code so that we don't need a specific hack here for the
@@ -1024,8 +1567,14 @@ void Platform::Screen::set_contrast(Contrast c)
     ::contrast = c;
 
     init_palette(current_spritesheet, sprite_palette, false);
-    init_palette(current_tilesheet0, tilesheet_0_palette, false);
-    init_palette(current_tilesheet1, tilesheet_1_palette, false);
+    init_palette(current_tilesheet0,
+                 tilesheet_0_palette,
+                 false,
+                 16 * tile0_palette_count);
+    init_palette(current_tilesheet1,
+                 tilesheet_1_palette,
+                 false,
+                 16 * tile1_palette_count);
     init_palette(current_overlay_texture, overlay_palette, true);
 }
 
@@ -1050,33 +1599,39 @@ static u32 validate_overlay_texture_size(Platform& pfrm, size_t size)
 }
 
 
+// set_tile() ORs a palette bank into each screen entry, so strip it, and hand
+// back the same tile index that the script passed to set_tile().
 u16 Platform::get_tile(Layer layer, u16 x, u16 y)
 {
+    u16 entry = 0;
+
     switch (layer) {
     case Layer::overlay:
         if (x > 31 or y > 31) {
             return 0;
         }
-        return overlay_back_buffer[x + y * 32] & ~(SE_PALBANK_MASK);
+        entry = overlay_back_buffer[x + y * 32];
+        break;
 
     case Layer::background:
         if (x > 31 or y > 31) {
             return 0;
         }
-        return MEM_SCREENBLOCKS[sbb_bg_tiles][x + y * 32];
+        entry = MEM_SCREENBLOCKS[sbb_bg_tiles][x + y * 32];
+        break;
 
     case Layer::map_0:
         if (x > 63 or y > 63) {
             return 0;
         }
         if (x < 32 and y < 32) {
-            return MEM_SCREENBLOCKS[sbb_t0_tiles][x + y * 32];
+            entry = MEM_SCREENBLOCKS[sbb_t0_tiles][x + y * 32];
         } else if (y < 32) {
-            return MEM_SCREENBLOCKS[sbb_t0_tiles + 1][(x - 32) + y * 32];
+            entry = MEM_SCREENBLOCKS[sbb_t0_tiles + 1][(x - 32) + y * 32];
         } else if (x < 32) {
-            return MEM_SCREENBLOCKS[sbb_t0_tiles + 2][x + (y - 32) * 32];
+            entry = MEM_SCREENBLOCKS[sbb_t0_tiles + 2][x + (y - 32) * 32];
         } else {
-            return MEM_SCREENBLOCKS[sbb_t0_tiles + 3][(x - 32) + (y - 32) * 32];
+            entry = MEM_SCREENBLOCKS[sbb_t0_tiles + 3][x - 32 + (y - 32) * 32];
         }
         break;
 
@@ -1085,16 +1640,18 @@ u16 Platform::get_tile(Layer layer, u16 x, u16 y)
             return 0;
         }
         if (x < 32 and y < 32) {
-            return MEM_SCREENBLOCKS[sbb_t1_tiles][x + y * 32];
+            entry = MEM_SCREENBLOCKS[sbb_t1_tiles][x + y * 32];
         } else if (y < 32) {
-            return MEM_SCREENBLOCKS[sbb_t1_tiles + 1][(x - 32) + y * 32];
+            entry = MEM_SCREENBLOCKS[sbb_t1_tiles + 1][(x - 32) + y * 32];
         } else if (x < 32) {
-            return MEM_SCREENBLOCKS[sbb_t1_tiles + 2][x + (y - 32) * 32];
+            entry = MEM_SCREENBLOCKS[sbb_t1_tiles + 2][x + (y - 32) * 32];
         } else {
-            return MEM_SCREENBLOCKS[sbb_t1_tiles + 3][(x - 32) + (y - 32) * 32];
+            entry = MEM_SCREENBLOCKS[sbb_t1_tiles + 3][x - 32 + (y - 32) * 32];
         }
+        break;
     }
-    return 0;
+
+    return entry & ~(SE_PALBANK_MASK);
 }
 
 
@@ -1153,14 +1710,16 @@ void Platform::Screen::fade(float amount,
             auto from = Color::from_bgr_hex_555(sprite_palette[i]);
             MEM_PALETTE[i] = blend(from, c, include_sprites ? amt : 0);
         }
-        for (int i = 0; i < 16; ++i) {
-            auto from = Color::from_bgr_hex_555(tilesheet_0_palette[i]);
-            MEM_BG_PALETTE[i] = blend(from, c, amt);
-        }
-        for (int i = 0; i < 16; ++i) {
-            auto from = Color::from_bgr_hex_555(tilesheet_1_palette[i]);
-            MEM_BG_PALETTE[32 + i] = blend(from, c, amt);
-        }
+        write_tile_palettes(tilesheet_0_palette,
+                            tile0_banks,
+                            tile0_palette_count,
+                            c,
+                            amt);
+        write_tile_palettes(tilesheet_1_palette,
+                            tile1_banks,
+                            tile1_palette_count,
+                            c,
+                            amt);
         if (include_overlay or overlay_was_faded) {
             for (int i = 0; i < 16; ++i) {
                 auto from = Color::from_bgr_hex_555(overlay_palette[i]);
@@ -1173,8 +1732,14 @@ void Platform::Screen::fade(float amount,
         const auto bc = nightmode_adjust(real_color(*base));
         for (int i = 0; i < 16; ++i) {
             MEM_PALETTE[i] = blend(bc, c, include_sprites ? amt : 0);
-            MEM_BG_PALETTE[i] = blend(bc, c, amt);
-            MEM_BG_PALETTE[32 + i] = blend(bc, c, amt);
+            for (int p = 0; p < tile0_palette_count; ++p) {
+                MEM_BG_PALETTE[tile0_banks[p] * 16 + i] =
+                    blend(bc, c, amt);
+            }
+            for (int p = 0; p < tile1_palette_count; ++p) {
+                MEM_BG_PALETTE[tile1_banks[p] * 16 + i] =
+                    blend(bc, c, amt);
+            }
 
             if (overlay_was_faded) {
                 // FIXME!
@@ -1225,6 +1790,54 @@ static u16 spritesheet_source_pal[16];
 static TextureData spritesheet_file_data;
 
 
+// Whether build.lua compressed the tile data of the current textures. For a
+// compressed texture, the texture's tile_data_ points to the bios data (see
+// gba_platform_compression.hpp), and tile_data_length_ holds the decompressed
+// size.
+static Compression spritesheet_compression = Compression::none;
+static Compression tile0_compression = Compression::none;
+static Compression tile1_compression = Compression::none;
+
+
+// Copy a texture's tiles into vram, decompressing them first if necessary.
+static void
+copy_texture_tiles(void* dest, const TextureData& info, Compression compression)
+{
+    switch (compression) {
+    case Compression::none:
+        memcpy16(dest, info.tile_data_, info.tile_data_length_ / 2);
+        break;
+
+    case Compression::lz77:
+        LZ77UnCompVram(info.tile_data_, dest);
+        break;
+
+    case Compression::rle:
+        RLUnCompVram(info.tile_data_, dest);
+        break;
+    }
+}
+
+
+// Point a texture at a file's tile data, which build.lua may have compressed.
+static Compression init_texture_tiles(TextureData& info,
+                                      const Filesystem::FileData& file)
+{
+    const auto compression = compression_of(file);
+
+    if (compression == Compression::none) {
+        info.tile_data_ = (const unsigned int*)file.data_;
+        info.tile_data_length_ = file.size_;
+    } else {
+        const auto stream = compressed_stream(file);
+        info.tile_data_ = (const unsigned int*)stream;
+        info.tile_data_length_ = decompressed_size(stream);
+    }
+
+    return compression;
+}
+
+
 static std::optional<Platform::FailureReason>
 push_spritesheet_texture(const TextureData& info)
 {
@@ -1234,7 +1847,23 @@ push_spritesheet_texture(const TextureData& info)
 
     const auto obj_vram_size = 1024 * 32;
 
-    if (info.tile_data_length_ > obj_vram_size) {
+    if (sprite_cache.enabled_ and
+        spritesheet_compression not_eq Compression::none) {
+
+        // The sprite cache uploads frames straight from the rom, as it needs
+        // them, which we can't do with compressed data.
+        Platform::FailureReason r;
+        r += "sprite streaming needs uncompressed sprites";
+        return r;
+
+    } else if (sprite_cache.enabled_) {
+        // Nothing to copy, display() uploads frames as they're needed.
+        sprite_cache.rom_tiles_ = (const u8*)info.tile_data_;
+        sprite_cache.rom_frame_count_ =
+            info.tile_data_length_ / SpriteCache::bytes_per_frame;
+        sprite_cache.reset();
+
+    } else if (info.tile_data_length_ > obj_vram_size) {
 
         const auto exceeded_bytes = info.tile_data_length_ - obj_vram_size;
 
@@ -1251,12 +1880,13 @@ push_spritesheet_texture(const TextureData& info)
         r += " tile(s).";
 
         return r;
-    }
 
-    // NOTE: There are four tile blocks, so index four points to the
-    // end of the tile memory.
-    memcpy16(
-        (void*)&MEM_TILE[4][1], info.tile_data_, info.tile_data_length_ / 2);
+    } else {
+        // NOTE: There are four tile blocks, so index four points to the
+        // end of the tile memory.
+        copy_texture_tiles(
+            (void*)&MEM_TILE[4][1], info, spritesheet_compression);
+    }
 
     // We need to do this, otherwise whatever screen fade is currently
     // active will be overwritten by the copy.
@@ -1270,8 +1900,24 @@ push_spritesheet_texture(const TextureData& info)
 }
 
 
-std::optional<Platform::FailureReason>
-Platform::load_sprite_texture(const char* name, int addr, int len)
+static void enable_sprite_streaming(bool enabled)
+{
+    if (enabled == sprite_cache.enabled_) {
+        return;
+    }
+
+    sprite_cache.enabled_ = enabled;
+
+    // Reload the current spritesheet in the new mode. If the spritesheet is too
+    // large to fit in vram, the caller needs to load a smaller one.
+    if (push_spritesheet_texture(*current_spritesheet)) {
+        error(*::platform, "spritesheet exceeds sprite vram capacity");
+    }
+}
+
+
+std::optional<Platform::FailureReason>
+Platform::load_sprite_texture(const char* name, int addr, int len)
 {
     StringBuffer<48> palette_file(name);
     palette_file += ".pal";
@@ -1287,11 +1933,11 @@ Platform::load_sprite_texture(const char* name, int addr, int len)
 
         TextureData& info = spritesheet_file_data;
         info.name_ = name;
-        info.tile_data_ = (const unsigned int*)img.data_;
         info.palette_data_ = spritesheet_source_pal;
-        info.tile_data_length_ = img.size_;
         info.palette_data_length_ = 16;
 
+        spritesheet_compression = init_texture_tiles(info, img);
+
         return push_spritesheet_texture(info);
     }
 
@@ -1299,6 +1945,7 @@ Platform::load_sprite_texture(const char* name, int addr, int len)
 
         if (str_cmp(name, info.name_) == 0) {
 
+            spritesheet_compression = Compression::none;
             return push_spritesheet_texture(info);
         }
     }
@@ -1314,16 +1961,96 @@ Platform::load_sprite_texture(const char* name, int addr, int len)
 }
 
 
-static u16 tile0_source_pal[16];
+// A tileset with several palettes stores the palettes back to back, followed
+// by a byte for each tile, holding the tile's palette number. Returns the
+// number of palettes in a tileset's palette file.
+static int tileset_palettes(u32 tile_data_size, u32 palette_size)
+{
+    const u32 tile_count = tile_data_size / 32;
+    if (palette_size <= 32 or palette_size < tile_count) {
+        return 1;
+    }
+
+    const u32 count = (palette_size - tile_count) / 32;
+    if (count > tile_layer_palettes or
+        count * 32 + tile_count not_eq palette_size) {
+        return 1;
+    }
+
+    return count;
+}
+
+
+// Palettes is null for tilesets with a single palette.
+static void init_tile_palettes(u8* table,
+                               const TextureData& info,
+                               int palette_count,
+                               const u8* palettes)
+{
+    const int tile_count = info.tile_data_length_ / 32;
+
+    for (int i = 0; i < tile_palette_table_size; ++i) {
+        u8 p = 0;
+        if (palettes and i < tile_count and palettes[i] < palette_count) {
+            p = palettes[i];
+        }
+        table[i] = p;
+    }
+}
+
+
+struct AnimatedTile {
+    Layer layer_;
+    u16 tile_;
+    u16 start_;
+    u8 length_;
+    u8 rate_;
+    u8 counter_;
+    u8 frame_;
+
+    // The tile's graphics from before the animation started, so that we can
+    // put them back when the animation stops. For compressed tilesets, the
+    // vram copy of the tileset is the only uncompressed copy that we have.
+    u8 original_[32];
+};
+
+
+static EWRAM_DATA Buffer<AnimatedTile, 32> animated_tiles;
+
+
+// Loading a tileset overwrites the animated tiles' graphics in vram, along
+// with the tiles that we saved, so we forget about the layer's animations.
+static void clear_tile_animations(Layer layer)
+{
+    for (auto it = animated_tiles.begin(); it not_eq animated_tiles.end();) {
+        if (it->layer_ == layer) {
+            it = animated_tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+
+static u16 tile0_source_pal[16 * tile_layer_palettes];
 static TextureData tile0_file_data;
 
 
 static std::optional<Platform::FailureReason>
-push_tile0_texture(const char* name, const TextureData& info)
+push_tile0_texture(const char* name,
+                   const TextureData& info,
+                   int palette_count = 1,
+                   const u8* palettes = nullptr)
 {
     current_tilesheet0 = &info;
 
-    init_palette(current_tilesheet0, tilesheet_0_palette, false);
+    clear_tile_animations(Layer::map_0);
+
+    tile0_palette_count = palette_count;
+    init_tile_palettes(tile0_palettes, info, palette_count, palettes);
+
+    init_palette(
+        current_tilesheet0, tilesheet_0_palette, false, 16 * palette_count);
 
 
     // We don't want to load the whole palette into memory, we might
@@ -1332,18 +2059,19 @@ push_tile0_texture(const char* name, const TextureData& info)
     // Also, like the sprite texture, we need to apply the currently
     // active screen fade while modifying the color palette.
     const auto c = nightmode_adjust(real_color(last_color));
-    for (int i = 0; i < 16; ++i) {
-        auto from = Color::from_bgr_hex_555(tilesheet_0_palette[i]);
-        MEM_BG_PALETTE[i] = blend(from, c, last_fade_amt);
-    }
+    write_tile_palettes(tilesheet_0_palette,
+                        tile0_banks,
+                        tile0_palette_count,
+                        c,
+                        last_fade_amt);
 
     auto exceeded_bytes =
         validate_tilemap_texture_size(*platform, info.tile_data_length_);
 
     if (not exceeded_bytes) {
-        memcpy16((void*)&MEM_SCREENBLOCKS[sbb_t0_texture][0],
-                 info.tile_data_,
-                 info.tile_data_length_ / 2);
+        copy_texture_tiles((void*)&MEM_SCREENBLOCKS[sbb_t0_texture][0],
+                           info,
+                           tile0_compression);
         return {};
     } else {
         Platform::FailureReason r;
@@ -1371,22 +2099,31 @@ Platform::load_tile0_texture(const char* name, int addr, int len)
 
     if (img.data_ and palette.data_) {
 
-        memcpy(tile0_source_pal, palette.data_, sizeof tile0_source_pal);
-
         TextureData& info = tile0_file_data;
         info.name_ = name;
-        info.tile_data_ = (const unsigned int*)img.data_;
+        tile0_compression = init_texture_tiles(info, img);
+
+        const int palettes =
+            tileset_palettes(info.tile_data_length_, palette.size_);
+
+        memcpy(tile0_source_pal, palette.data_, palettes * 32);
+
         info.palette_data_ = tile0_source_pal;
-        info.tile_data_length_ = img.size_;
-        info.palette_data_length_ = 16;
+        info.palette_data_length_ = 16 * palettes;
 
-        return push_tile0_texture(name, info);
+        const u8* tile_palettes = nullptr;
+        if (palettes > 1) {
+            tile_palettes = (const u8*)palette.data_ + palettes * 32;
+        }
+
+        return push_tile0_texture(name, info, palettes, tile_palettes);
     }
 
     for (auto& info : tile_textures) {
 
         if (str_cmp(name, info.name_) == 0) {
 
+            tile0_compression = Compression::none;
             return push_tile0_texture(name, info);
         }
     }
@@ -1402,16 +2139,25 @@ Platform::load_tile0_texture(const char* name, int addr, int len)
 }
 
 
-static u16 tile1_source_pal[16];
+static u16 tile1_source_pal[16 * tile_layer_palettes];
 static TextureData tile1_file_data;
 
 
 static std::optional<Platform::FailureReason>
-push_tile1_texture(const char* name, const TextureData& info)
+push_tile1_texture(const char* name,
+                   const TextureData& info,
+                   int palette_count = 1,
+                   const u8* palettes = nullptr)
 {
     current_tilesheet1 = &info;
 
-    init_palette(current_tilesheet1, tilesheet_1_palette, false);
+    clear_tile_animations(Layer::map_1);
+
+    tile1_palette_count = palette_count;
+    init_tile_palettes(tile1_palettes, info, palette_count, palettes);
+
+    init_palette(
+        current_tilesheet1, tilesheet_1_palette, false, 16 * palette_count);
 
     // We don't want to load the whole palette into memory, we might
     // overwrite palettes used by someone else, e.g. the overlay...
@@ -1419,18 +2165,19 @@ push_tile1_texture(const char* name, const TextureData& info)
     // Also, like the sprite texture, we need to apply the currently
     // active screen fade while modifying the color palette.
     const auto c = nightmode_adjust(real_color(last_color));
-    for (int i = 0; i < 16; ++i) {
-        auto from = Color::from_bgr_hex_555(tilesheet_1_palette[i]);
-        MEM_BG_PALETTE[32 + i] = blend(from, c, last_fade_amt);
-    }
+    write_tile_palettes(tilesheet_1_palette,
+                        tile1_banks,
+                        tile1_palette_count,
+                        c,
+                        last_fade_amt);
 
     auto exceeded_bytes =
         validate_tilemap_texture_size(*platform, info.tile_data_length_);
 
     if (not exceeded_bytes) {
-        memcpy16((void*)&MEM_SCREENBLOCKS[sbb_t1_texture][0],
-                 info.tile_data_,
-                 info.tile_data_length_ / 2);
+        copy_texture_tiles((void*)&MEM_SCREENBLOCKS[sbb_t1_texture][0],
+                           info,
+                           tile1_compression);
         return {};
     } else {
         Platform::FailureReason r;
@@ -1458,22 +2205,31 @@ Platform::load_tile1_texture(const char* name, int addr, int len)
 
     if (img.data_ and palette.data_) {
 
-        memcpy(tile1_source_pal, palette.data_, sizeof tile1_source_pal);
-
         TextureData& info = tile1_file_data;
         info.name_ = name;
-        info.tile_data_ = (const unsigned int*)img.data_;
+        tile1_compression = init_texture_tiles(info, img);
+
+        const int palettes =
+            tileset_palettes(info.tile_data_length_, palette.size_);
+
+        memcpy(tile1_source_pal, palette.data_, palettes * 32);
+
         info.palette_data_ = tile1_source_pal;
-        info.tile_data_length_ = img.size_;
-        info.palette_data_length_ = 16;
+        info.palette_data_length_ = 16 * palettes;
+
+        const u8* tile_palettes = nullptr;
+        if (palettes > 1) {
+            tile_palettes = (const u8*)palette.data_ + palettes * 32;
+        }
 
-        return push_tile1_texture(name, info);
+        return push_tile1_texture(name, info, palettes, tile_palettes);
     }
 
     for (auto& info : tile_textures) {
 
         if (str_cmp(name, info.name_) == 0) {
 
+            tile1_compression = Compression::none;
             return push_tile1_texture(name, info);
         }
     }
@@ -1489,6 +2245,147 @@ Platform::load_tile1_texture(const char* name, int addr, int len)
 }
 
 
+// Overwrite the pixels of a tile in vram with the pixels of another tile from
+// the layer's source texture.
+static void copy_tile_graphics(Layer layer, u16 dest_tile, u16 src_tile)
+{
+    const auto tex = layer == Layer::map_1 ? current_tilesheet1
+                                           : current_tilesheet0;
+
+    const auto sbb = layer == Layer::map_1 ? sbb_t1_texture : sbb_t0_texture;
+
+    const auto compression =
+        layer == Layer::map_1 ? tile1_compression : tile0_compression;
+
+    const u32 tile_bytes = 32;
+
+    if ((src_tile + 1) * tile_bytes > tex->tile_data_length_ or
+        (dest_tile + 1) * tile_bytes > tex->tile_data_length_) {
+        return;
+    }
+
+    const auto vram = (u8*)&MEM_SCREENBLOCKS[sbb][0];
+
+    // We can't pick single tiles out of compressed data, so for compressed
+    // tilesets, we copy the frames from the tileset in vram instead.
+    const u8* src = (const u8*)tex->tile_data_;
+    if (compression not_eq Compression::none) {
+        src = vram;
+    }
+
+    // NOTE: the bundle only aligns files to halfwords, so the source tile may
+    // not be word aligned.
+    memcpy16(vram + dest_tile * tile_bytes,
+             src + src_tile * tile_bytes,
+             tile_bytes / 2);
+}
+
+
+// Returns the tile's pixels in vram, or nullptr if the layer's texture has no
+// such tile.
+static u8* tile_graphics(Layer layer, u16 tile)
+{
+    const auto tex = layer == Layer::map_1 ? current_tilesheet1
+                                           : current_tilesheet0;
+
+    const auto sbb = layer == Layer::map_1 ? sbb_t1_texture : sbb_t0_texture;
+
+    const u32 tile_bytes = 32;
+
+    if ((tile + 1) * tile_bytes > tex->tile_data_length_) {
+        return nullptr;
+    }
+
+    return (u8*)&MEM_SCREENBLOCKS[sbb][0] + tile * tile_bytes;
+}
+
+
+static void save_tile_graphics(AnimatedTile& anim)
+{
+    if (auto pixels = tile_graphics(anim.layer_, anim.tile_)) {
+        memcpy16(anim.original_, pixels, sizeof anim.original_ / 2);
+    }
+}
+
+
+static void restore_tile_graphics(const AnimatedTile& anim)
+{
+    if (auto pixels = tile_graphics(anim.layer_, anim.tile_)) {
+        memcpy16(pixels, anim.original_, sizeof anim.original_ / 2);
+    }
+}
+
+
+bool Platform::animate_tile(Layer layer, u16 tile, u16 start, u8 len, u8 rate)
+{
+    if (layer == Layer::overlay) {
+        return false;
+    }
+
+    // The background shares a texture with map_0.
+    if (layer == Layer::background) {
+        layer = Layer::map_0;
+    }
+
+    for (auto it = animated_tiles.begin(); it not_eq animated_tiles.end();
+         ++it) {
+        if (it->layer_ == layer and it->tile_ == tile) {
+            if (len == 0) {
+                restore_tile_graphics(*it);
+                animated_tiles.erase(it);
+            } else {
+                // Keep the original graphics that we saved when the tile first
+                // started animating.
+                it->start_ = start;
+                it->length_ = len;
+                it->rate_ = rate;
+                it->counter_ = 0;
+                it->frame_ = 0;
+                copy_tile_graphics(layer, tile, start);
+            }
+            return true;
+        }
+    }
+
+    if (len == 0) {
+        return true;
+    }
+
+    AnimatedTile anim;
+    anim.layer_ = layer;
+    anim.tile_ = tile;
+    anim.start_ = start;
+    anim.length_ = len;
+    anim.rate_ = rate;
+    anim.counter_ = 0;
+    anim.frame_ = 0;
+    save_tile_graphics(anim);
+
+    if (not animated_tiles.push_back(anim)) {
+        return false;
+    }
+
+    copy_tile_graphics(layer, tile, start);
+
+    return true;
+}
+
+
+static void update_animated_tiles()
+{
+    for (auto& anim : animated_tiles) {
+        if (++anim.counter_ >= anim.rate_) {
+            anim.counter_ = 0;
+            if (++anim.frame_ == anim.length_) {
+                anim.frame_ = 0;
+            }
+            const u16 src = anim.start_ + anim.frame_;
+            copy_tile_graphics(anim.layer_, anim.tile_, src);
+        }
+    }
+}
+
+
 void Platform::sleep(u32 frames)
 {
     // NOTE: A sleep call should just pause the game for some number of frames,
@@ -1517,39 +2414,10 @@ bool Platform::is_running() const
 }
 
 
-static byte* const cartridge_ram = (byte*)0x0E000000;
-
-
-static bool
-flash_byteverify(void* in_dst, const void* in_src, unsigned int length)
-{
-    unsigned char* src = (unsigned char*)in_src;
-    unsigned char* dst = (unsigned char*)in_dst;
-
-    for (; length > 0; length--) {
-
-        if (*dst++ != *src++)
-            return true;
-    }
-    return false;
-}
+#include "gba_platform_savestore.hpp"
 
 
-static void
-flash_bytecpy(void* in_dst, const void* in_src, unsigned int length, bool write)
-{
-    unsigned char* src = (unsigned char*)in_src;
-    unsigned char* dst = (unsigned char*)in_dst;
-
-    for (; length > 0; length--) {
-        if (write) {
-            *(volatile u8*)0x0E005555 = 0xAA;
-            *(volatile u8*)0x0E002AAA = 0x55;
-            *(volatile u8*)0x0E005555 = 0xA0;
-        }
-        *dst++ = *src++;
-    }
-}
+static byte* const cartridge_ram = (byte*)0x0E000000;
 
 
 static void set_flash_bank(u32 bankID)
@@ -1562,41 +2430,25 @@ static void set_flash_bank(u32 bankID)
     }
 }
 
-// FIXME: Lets be nice to the flash an not write to the same memory
-// location every single time! What about a list? Each new save will
-// have a unique id. On startup, scan through memory until you reach
-// the highest unique id. Then start writing new saves at that
-// point. NOTE: My everdrive uses SRAM for Flash writes anyway, so
-// it's probably not going to wear out, but I like to pretend that I'm
-// developing a real gba game.
 
-
-COLD static bool flash_save(const void* data, u32 flash_offset, u32 length)
-{
-    if ((u32)flash_offset >= 0x10000) {
-        set_flash_bank(1);
-    } else {
-        set_flash_bank(0);
+struct CartridgeRamBus {
+    u8 read(u32 offset)
+    {
+        return ((volatile u8*)cartridge_ram)[offset];
     }
 
-    flash_bytecpy((void*)(cartridge_ram + flash_offset), data, length, true);
-
-    return flash_byteverify(
-        (void*)(cartridge_ram + flash_offset), data, length);
-}
-
-
-static void flash_load(void* dest, u32 flash_offset, u32 length)
-{
-    if (flash_offset >= 0x10000) {
-        set_flash_bank(1);
-    } else {
-        set_flash_bank(0);
+    void write(u32 offset, u8 value)
+    {
+        ((volatile u8*)cartridge_ram)[offset] = value;
     }
+};
 
-    flash_bytecpy(
-        dest, (const void*)(cartridge_ram + flash_offset), length, false);
-}
+
+// On flash cartridges, we save through a journaled store (see
+// gba_platform_savestore.hpp), so that we don't wear out the same few sectors
+// of the chip, and so that we only write the parts of the save data that
+// changed. The store lives in the first bank of the chip.
+static SaveStore<CartridgeRamBus> flash_store{CartridgeRamBus{}};
 
 
 static bool save_using_flash = false;
@@ -1612,31 +2464,55 @@ READ_ONLY_DATA alignas(4) [[gnu::used]] static const
     char backup_type[] = {'S', 'R', 'A', 'M', '_', 'V', 'n', 'n', 'n'};
 
 
-void sram_save(const void* data, u32 offset, u32 length)
+__attribute__((section(".iwram"), long_call)) void
+sram_block_copy(u8* dest, const u8* src, u32 length);
+
+
+void sram_copy(void* dest, const void* src, u32 length)
 {
-    u8* save_mem = (u8*)cartridge_ram + offset;
+    sram_block_copy((u8*)dest, (const u8*)src, length);
+}
+
+
+u32 decompress(const Filesystem::FileData& file, void* dest)
+{
+    const auto compression = compression_of(file);
+    if (compression == Compression::none) {
+        return 0;
+    }
+
+    const auto stream = compressed_stream(file);
 
+    if (dest) {
+        if (compression == Compression::lz77) {
+            LZ77UnCompWram(stream, dest);
+        } else {
+            RLUnCompWram(stream, dest);
+        }
+    }
+
+    return decompressed_size(stream);
+}
+
+
+void sram_save(const void* data, u32 offset, u32 length)
+{
     // The cartridge has an 8-bit bus, so you have to write one byte at a time,
     // otherwise it won't work!
-    for (size_t i = 0; i < length; ++i) {
-        *save_mem++ = ((const u8*)data)[i];
-    }
+    sram_copy((u8*)cartridge_ram + offset, data, length);
 }
 
 
 void sram_load(void* dest, u32 offset, u32 length)
 {
-    u8* save_mem = (u8*)cartridge_ram + offset;
-    for (size_t i = 0; i < length; ++i) {
-        ((u8*)dest)[i] = *save_mem++;
-    }
+    sram_copy(dest, (u8*)cartridge_ram + offset, length);
 }
 
 
 bool Platform::write_save_data(const void* data, u32 length)
 {
     if (save_using_flash) {
-        return flash_save(data, 0, length);
+        return flash_store.write(static_cast<const u8*>(data), length);
     } else {
         sram_save(data, 0, length);
         return true;
@@ -1647,7 +2523,7 @@ bool Platform::write_save_data(const void* data, u32 length)
 bool Platform::read_save_data(void* buffer, u32 data_length)
 {
     if (save_using_flash) {
-        flash_load(buffer, 0, data_length);
+        flash_store.read(static_cast<u8*>(buffer), data_length);
     } else {
         sram_load(buffer, 0, data_length);
     }
@@ -1732,11 +2608,7 @@ void Platform::Logger::log(Severity level, const char* msg)
 
 void Platform::Logger::read(void* buffer, u32 start_offset, u32 num_bytes)
 {
-    if (save_using_flash) {
-        flash_load(buffer, sizeof(PersistentData) + start_offset, num_bytes);
-    } else {
-        sram_load(buffer, sizeof(PersistentData) + start_offset, num_bytes);
-    }
+    sram_load(buffer, sizeof(PersistentData) + start_offset, num_bytes);
 }
 
 
@@ -1744,7 +2616,8 @@ void Platform::Logger::read(void* buffer, u32 start_offset, u32 num_bytes)
 // Speaker
 //
 // For music, the Speaker class uses the GameBoy's direct sound chip to play
-// 8-bit signed raw audio, at 16kHz.
+// 8-bit signed raw audio, at 16kHz, or IMA-ADPCM compressed audio, which we
+// decode into 8-bit samples on the fly.
 //
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -1773,12 +2646,20 @@ static const u32 null_music[null_music_len] = {0, 0, 0, 0, 0, 0, 0, 0};
     DEF_AUDIO(__STR_NAME__, __TRACK_NAME__, 1)
 
 
-#include "gba_platform_soundcontext.hpp"
+#include "gba_platform_mixer.hpp"
+#include "gba_platform_music.hpp"
 
 
 SoundContext snd_ctx;
 
 
+static MusicPlayer music_player;
+
+
+__attribute__((section(".iwram"), long_call)) void
+audio_fill_music(MusicPlayer& player, SoundContext& ctx);
+
+
 static const struct AudioTrack {
     const char* name_;
     const AudioSample* data_;
@@ -1834,97 +2715,117 @@ Microseconds Platform::Speaker::track_length(const char* name)
 }
 
 
-static std::optional<ActiveSoundInfo> make_sound(const char* name)
-{
-    if (auto sound = get_sound(name)) {
-        return ActiveSoundInfo{0, sound->length_, sound->data_, 0};
-    } else {
-        return {};
-    }
-}
-
-
 // If you're going to edit any of the variables used by the interrupt handler
-// for audio playback, you should use this helper function.
+// for audio playback, you should use this helper function. Depending on the
+// mixer mode, the audio code runs either in the timer interrupt, or in the
+// vblank interrupt, so we just mask all interrupts for a moment.
 template <typename F> auto modify_audio(F&& callback)
 {
-    irqDisable(IRQ_TIMER0);
+    const auto ime = REG_IME;
+    REG_IME = 0;
     callback();
-    irqEnable(IRQ_TIMER0);
+    REG_IME = ime;
 }
 
 
 bool Platform::Speaker::is_sound_playing(const char* name)
 {
     if (auto sound = get_sound(name)) {
-        bool playing = false;
-        modify_audio([&] {
-            for (const auto& info : snd_ctx.active_sounds) {
-                if ((s8*)sound->data_ == info.data_) {
-                    playing = true;
-                    return;
-                }
+        for (const auto& ch : snd_ctx.channels) {
+            if (ch.data_ == sound->data_) {
+                return true;
             }
-        });
-
-        return playing;
+        }
     }
     return false;
 }
 
 
+bool Platform::Speaker::is_playing(SoundHandle sound)
+{
+    return snd_ctx.find(sound) not_eq nullptr;
+}
+
+
+void Platform::Speaker::stop_sound(SoundHandle sound)
+{
+    if (auto ch = snd_ctx.find(sound)) {
+        modify_audio([&] { ch->data_ = nullptr; });
+    }
+}
+
+
+void Platform::Speaker::set_volume(SoundHandle sound, Float volume)
+{
+    if (auto ch = snd_ctx.find(sound)) {
+        const int v = volume * audio_full_volume;
+        ch->set_volume(clamp(v, 0, 255), ch->pan_);
+    }
+}
+
+
+void Platform::Speaker::set_pan(SoundHandle sound, Float pan)
+{
+    if (auto ch = snd_ctx.find(sound)) {
+        const int full = audio_full_volume;
+        const int p = pan * full;
+        ch->set_volume(ch->volume_, clamp(p, -full, full));
+    }
+}
+
+
 void Platform::Speaker::set_position(const Vec2<Float>&)
 {
     // We don't support spatialized audio on the gameboy.
 }
 
 
-static void push_sound(const ActiveSoundInfo& info)
+static Platform::Speaker::SoundHandle
+push_sound(const AudioSample* data, s32 length, int priority)
 {
-    modify_audio([&] {
-        if (not snd_ctx.active_sounds.full()) {
-            snd_ctx.active_sounds.push_back(info);
+    // No need to mask interrupts while picking a channel, the mixer never
+    // starts sounds, it only stops them.
+    const int channel = snd_ctx.pick_channel(priority);
+    if (channel == -1) {
+        return Platform::Speaker::null_sound;
+    }
 
-        } else {
-            ActiveSoundInfo* lowest = snd_ctx.active_sounds.begin();
-            for (auto it = snd_ctx.active_sounds.begin();
-                 it not_eq snd_ctx.active_sounds.end();
-                 ++it) {
-                if (it->priority_ < lowest->priority_) {
-                    lowest = it;
-                }
-            }
+    Platform::Speaker::SoundHandle handle;
+    modify_audio(
+        [&] { handle = snd_ctx.start(channel, data, length, priority); });
 
-            if (lowest not_eq snd_ctx.active_sounds.end() and
-                lowest->priority_ < info.priority_) {
-                snd_ctx.active_sounds.erase(lowest);
-                snd_ctx.active_sounds.push_back(info);
-            }
-        }
-    });
+    return handle;
 }
 
 
-void Platform::Speaker::play_sound(const char* name,
-                                   int priority,
-                                   std::optional<Vec2<Float>> position)
+Platform::Speaker::SoundHandle
+Platform::Speaker::play_sound(const char* name,
+                              int priority,
+                              std::optional<Vec2<Float>> position)
 {
     (void)position; // We're not using position data, because on the gameboy
                     // advance, we aren't supporting spatial audio.
 
-    if (auto info = make_sound(name)) {
-        info->priority_ = priority;
-        push_sound(*info);
-        return;
+    if (auto sound = get_sound(name)) {
+        return push_sound(sound->data_, sound->length_, priority);
     }
 
     auto sound_file = platform->fs().get_file(name);
     if (sound_file.data_) {
-        ActiveSoundInfo info{0, static_cast<s32>(sound_file.size_), 0, 0};
-        info.priority_ = priority;
-        info.data_ = reinterpret_cast<const s8*>(sound_file.data_);
-        push_sound(info);
+        AdpcmStream stream;
+        if (adpcm_open(stream,
+                       reinterpret_cast<const u8*>(sound_file.data_),
+                       sound_file.size_)) {
+            warning(*::platform, "adpcm is only supported for music!");
+            return null_sound;
+        }
+
+        return push_sound(reinterpret_cast<const s8*>(sound_file.data_),
+                          sound_file.size_,
+                          priority);
     }
+
+    return null_sound;
 }
 
 
@@ -1936,6 +2837,7 @@ static void clear_music()
     snd_ctx.music_track = reinterpret_cast<const AudioSample*>(null_music);
     snd_ctx.music_track_length = null_music_len - 1;
     snd_ctx.music_track_pos = 0;
+    music_player.stop(snd_ctx);
 }
 
 
@@ -1951,50 +2853,63 @@ void Platform::Speaker::stop_music()
 }
 
 
-static void play_music(const char* name, Microseconds offset)
+// Whether the frame mixer, rather than the timer interrupt, mixes the audio.
+static bool audio_frame_mixer = false;
+
+
+void Platform::Speaker::play_music(const char* name,
+                                   Microseconds offset,
+                                   const MusicOptions& options)
 {
+    // NOTE: The sound sample needs to be mono, and 8-bit signed. To export this
+    // format from Audacity, convert the tracks to mono via the Tracks dropdown,
+    // and then export as raw, in the format 8-bit signed.
+    //
+    // Also, important to convert the sound file frequency to 16kHz.
+
     auto music_file = platform->fs().get_file(name);
     if (music_file.data_ == nullptr) {
         warning(*::platform, "failed to find music file!");
         return;
     }
 
-    const Microseconds sample_offset = offset * 0.016f; // NOTE: because 16kHz
+    MusicSource source;
+    if (not source.open(reinterpret_cast<const u8*>(music_file.data_),
+                        music_file.size_)) {
+        warning(*::platform, "empty music file!");
+        return;
+    }
 
-    modify_audio([&] {
-        snd_ctx.music_track_length = music_file.size_;
-        snd_ctx.music_track = reinterpret_cast<const s8*>(music_file.data_);
-        snd_ctx.music_track_pos = sample_offset % music_file.size_;
-    });
-}
+    source.loop_start_ = options.loop_start_ % source.length_;
+    source.seek(offset * 0.016f); // NOTE: because 16kHz
 
+    if (options.queue_ and music_player.playing()) {
+        modify_audio([&] { music_player.queue(source); });
+        return;
+    }
 
-void Platform::Speaker::play_music(const char* name, Microseconds offset)
-{
-    // NOTE: The sound sample needs to be mono, and 8-bit signed. To export this
-    // format from Audacity, convert the tracks to mono via the Tracks dropdown,
-    // and then export as raw, in the format 8-bit signed.
-    //
-    // Also, important to convert the sound file frequency to 16kHz.
+    // During a crossfade, the previous track plays from the idle deck, which
+    // we're about to load the new track into.
+    modify_audio([] { music_player.cancel_fade(snd_ctx); });
 
-    this->stop_music();
+    // The slow part, decoding the start of the track, happens here, with
+    // interrupts enabled, while the current track keeps playing. We only mask
+    // interrupts to flip a few pointers.
+    music_player.load(source);
 
-    ::play_music(name, offset);
+    // The mixer steps the fade once per four samples that it plays, which
+    // happens at 16kHz in the timer interrupt, but at about 18157Hz in the
+    // frame mixer, where we resample our 16kHz tracks.
+    const u32 fade_samples = audio_frame_mixer
+                                 ? mixer_samples(options.fade_)
+                                 : u32(options.fade_ * 0.016f);
+    modify_audio([&] { music_player.start(snd_ctx, fade_samples); });
+}
 
-    // FIXME!!!!!! Mysteriously, there's a weird audio glitch, where the sound
-    // effects, but not the music, get all glitched out until two sounds are
-    // played consecutively. I've spent hours trying to figure out what's going
-    // wrong, and I haven't solved this one yet, so for now, just play a couple
-    // quiet sounds. To add further confusion, after adjusting the instruction
-    // prefetch and waitstats, I need to play three sounds
-    // consecutively... obviously my interrupt service routine for the audio is
-    // flawed somehow. Do I need to completely disable the timers and sound
-    // chip, as well as the audio interrupts, when playing new sounds? Does
-    // disabling the audio interrupts when queueing a new sound effect cause
-    // audio artifacts, because the sound chip is not receiving samples?
-    play_sound("msg", 0);
-    play_sound("msg", 0);
-    play_sound("msg", 0);
+
+void Platform::Speaker::play_music(const char* name, Microseconds offset)
+{
+    play_music(name, offset, {});
 }
 
 
@@ -2009,6 +2924,12 @@ Platform::Speaker::Speaker()
 
 
 #define REG_SGFIFOA *(volatile u32*)0x40000A0
+#define REG_SGFIFOB *(volatile u32*)0x40000A4
+
+
+// In stereo mode, direct sound A plays the left channel, and direct sound B
+// plays the right channel.
+static bool audio_stereo = false;
 
 
 // NOTE: I tried to move this audio update interrupt handler to IWRAM, but the
@@ -2032,30 +2953,84 @@ static void audio_update_isr()
 {
     alignas(4) AudioSample mixing_buffer[4];
 
-    for (int i = 0; i < 4; ++i) {
-        mixing_buffer[i] = snd_ctx.music_track[snd_ctx.music_track_pos++];
+    // The timer runs at the sound files' sample rate, so no resampling.
+    if (audio_stereo) {
+        alignas(4) AudioSample mixing_buffer_right[4];
+        mix_audio_frame_stereo(
+            snd_ctx, mixing_buffer, mixing_buffer_right, 4, 1 << 16);
+        REG_SGFIFOB = *((u32*)mixing_buffer_right);
+    } else {
+        mix_audio_frame(snd_ctx, mixing_buffer, 4, 1 << 16);
     }
 
-    if (UNLIKELY(snd_ctx.music_track_pos > snd_ctx.music_track_length)) {
-        snd_ctx.music_track_pos = 0;
-    }
+    REG_SGFIFOA = *((u32*)mixing_buffer);
+}
 
-    // Maybe the world's worst sound mixing code...
-    for (auto it = snd_ctx.active_sounds.begin();
-         it not_eq snd_ctx.active_sounds.end();) {
-        if (UNLIKELY(it->position_ + 4 >= it->length_)) {
-            it = snd_ctx.active_sounds.erase(it);
 
-        } else {
-            for (int i = 0; i < 4; ++i) {
-                mixing_buffer[i] += it->data_[it->position_++];
-            }
+__attribute__((section(".iwram"), long_call)) void
+audio_mix_frame(SoundContext& ctx, AudioSample* out);
 
-            ++it;
-        }
+
+__attribute__((section(".iwram"), long_call)) void
+audio_mix_frame_stereo(SoundContext& ctx,
+                       AudioSample* left,
+                       AudioSample* right);
+
+
+// With the frame mixer enabled, the sound dma plays one of these buffers while
+// we mix the next frame into the other one.
+alignas(4) static AudioSample audio_frame_buffers[2][mixer_frame_samples];
+alignas(4) static AudioSample
+    audio_frame_buffers_right[2][mixer_frame_samples];
+static int audio_frame_playing = 0;
+
+
+// Point the sound dma channels at the playing buffers: dma1 feeds direct sound
+// A, and in stereo mode, dma2 feeds direct sound B.
+static void audio_frame_mixer_start_dma()
+{
+    const auto playing = audio_frame_playing;
+
+    REG_DMA1CNT_H = 0;
+    REG_DMA1SAD = (intptr_t)audio_frame_buffers[playing];
+    REG_DMA1CNT_H = 0xB640; // enable, fifo timing, repeat, 32 bit, fixed dest
+
+    if (audio_stereo) {
+        REG_DMA2CNT_H = 0;
+        REG_DMA2SAD = (intptr_t)audio_frame_buffers_right[playing];
+        REG_DMA2CNT_H = 0xB640;
     }
+}
 
-    REG_SGFIFOA = *((u32*)mixing_buffer);
+
+// Called at the very start of the vblank, so that we swap buffers right when
+// the dma finishes playing the previous one.
+static void audio_frame_mixer_swap()
+{
+    audio_frame_playing = not audio_frame_playing;
+
+    audio_frame_mixer_start_dma();
+}
+
+
+static void audio_frame_mixer_mix()
+{
+    // Mixing a frame's worth of samples takes a while. Re-enable interrupts,
+    // so that we don't miss any serial interrupts during multiplayer games, or
+    // sprite multiplexer hblanks. Unlike a cpu copy, the sound dma only ever
+    // transfers sixteen bytes at a time, so it won't hold up the serial
+    // interrupts either.
+    REG_IME = 1;
+
+    const auto mixing = not audio_frame_playing;
+
+    if (audio_stereo) {
+        audio_mix_frame_stereo(snd_ctx,
+                               audio_frame_buffers[mixing],
+                               audio_frame_buffers_right[mixing]);
+    } else {
+        audio_mix_frame(snd_ctx, audio_frame_buffers[mixing]);
+    }
 }
 
 
@@ -2074,6 +3049,10 @@ static std::optional<Platform::WatchdogCallback> watchdog_callback;
 
 static void vblank_isr()
 {
+    if (audio_frame_mixer) {
+        audio_frame_mixer_swap();
+    }
+
     const auto ten_seconds = 600; // approx. 60 fps
     watchdog_counter += 1;
 
@@ -2085,7 +3064,22 @@ static void vblank_isr()
         restart();
     }
 
+    if (multiplexer) {
+        multiplexer_vblank();
+    }
+
     ++vblank_count;
+
+    // NOTE: audio decoding and mixing enable nested interrupts, so do this
+    // last.
+    if (music_player.playing()) {
+        REG_IME = 1;
+        audio_fill_music(music_player, snd_ctx);
+    }
+
+    if (audio_frame_mixer) {
+        audio_frame_mixer_mix();
+    }
 }
 
 
@@ -2135,12 +3129,12 @@ Platform::ScratchBufferPtr Platform::make_scratch_buffer()
         &scratch_buffer_pool, finalizer);
     if (maybe_buffer) {
         ++scratch_buffers_in_use;
-        if (scratch_buffers_in_use > scratch_buffer_highwater) {
-            scratch_buffer_highwater = scratch_buffers_in_use;
+        if (scratch_buffers_in_use > ::scratch_buffer_highwater) {
+            ::scratch_buffer_highwater = scratch_buffers_in_use;
 
             StringBuffer<60> str = "sbr highwater: ";
             char buf[10];
-            english__to_string(scratch_buffer_highwater, buf, 10);
+            english__to_string(::scratch_buffer_highwater, buf, 10);
 
             str += buf;
 
@@ -2161,46 +3155,56 @@ int Platform::scratch_buffers_remaining()
 }
 
 
+int Platform::scratch_buffer_highwater()
+{
+    return ::scratch_buffer_highwater;
+}
+
+
 Platform::~Platform()
 {
     // ...
 }
 
 
-struct GlyphMapping {
-    utf8::Codepoint character_;
-
-    // -1 represents unassigned. Mapping a tile into memory sets the reference
-    //  count to zero. When a call to Platform::set_tile reduces the reference
-    //  count back to zero, the tile is once again considered to be unassigned,
-    //  and will be set to -1.
-    s16 reference_count_ = -1;
+static std::optional<DynamicMemory<GlyphTable>> glyph_table;
 
-    bool valid() const
-    {
-        return reference_count_ > -1;
-    }
-};
 
+// NOTE: The linker or some other part of the toolchain seems to have trouble
+// with large image file sizes, because when I try to include a single gigantic
+// charset file in the project, I end up with garbage data. I believe that I've
+// narrowed it down to some part of the build toolchain, because when I simply
+// use a truncated charset file, everything works fine. A really bizzare
+// issue. So the charset is split across several bins, named charset0,
+// charset1, etc. We look the bins up once, rather than for each new glyph.
+static constexpr int charset_bin_size = 12000 / 8;
+static constexpr int max_charset_bins = 8;
+static const TextureData* charset_bins[max_charset_bins];
 
-static constexpr const auto glyph_start_offset = 1;
-static constexpr const auto glyph_mapping_count = 78;
 
-struct GlyphTable {
-    GlyphMapping mappings_[glyph_mapping_count];
-};
+static void resolve_charset_bins()
+{
+    for (int bin = 0; bin < max_charset_bins; ++bin) {
+        char buf[15];
 
-static std::optional<DynamicMemory<GlyphTable>> glyph_table;
+        StringBuffer<100> charset_name = "charset";
+        english__to_string(bin, buf, 10);
+        charset_name += buf;
 
+        charset_bins[bin] = nullptr;
 
-static void audio_start()
-{
-    clear_music();
+        for (auto& info : overlay_textures) {
+            if (str_cmp(charset_name.c_str(), info.name_) == 0) {
+                charset_bins[bin] = &info;
+                break;
+            }
+        }
+    }
+}
 
-    REG_SOUNDCNT_H =
-        0x0B0F; //DirectSound A + fifo reset + max volume to L and R
-    REG_SOUNDCNT_X = 0x0080; //turn sound chip on
 
+static void start_isr_mixer()
+{
     irqEnable(IRQ_TIMER1);
     irqSet(IRQ_TIMER1, audio_update_isr);
 
@@ -2218,6 +3222,99 @@ static void audio_start()
 }
 
 
+// Both direct sound channels take their sample rate from timer 0. In mono
+// mode, direct sound A plays on both speakers. In stereo mode, A plays on the
+// left, and B on the right.
+static u16 audio_soundcnt_h()
+{
+    if (audio_stereo) {
+        return SDS_DMG100 | SDS_A100 | SDS_B100 | SDS_AL | SDS_BR |
+               SDS_ATMR0 | SDS_BTMR0 | SDS_ARESET | SDS_BRESET;
+    }
+    return 0x0B0F; //DirectSound A + fifo reset + max volume to L and R
+}
+
+
+// Stop the sound timers and dma channels, reset the fifos, and start over
+// with the current mixer mode. Call with interrupts masked.
+static void audio_restart()
+{
+    REG_TM0CNT_H = 0;
+    REG_TM1CNT_H = 0;
+    REG_DMA1CNT_H = 0;
+    REG_DMA2CNT_H = 0;
+
+    REG_SOUNDCNT_H = audio_soundcnt_h();
+
+    if (audio_frame_mixer) {
+        irqDisable(IRQ_TIMER1);
+
+        for (auto& buffer : audio_frame_buffers) {
+            for (auto& sample : buffer) {
+                sample = 0;
+            }
+        }
+
+        for (auto& buffer : audio_frame_buffers_right) {
+            for (auto& sample : buffer) {
+                sample = 0;
+            }
+        }
+
+        // Play silence until the next vblank, when we swap to the first mixed
+        // buffer.
+        audio_frame_playing = 1;
+        REG_DMA1DAD = (intptr_t)&REG_SGFIFOA;
+        REG_DMA2DAD = (intptr_t)&REG_SGFIFOB;
+        audio_frame_mixer_start_dma();
+
+        // Timer 0 sets the sample rate for direct sound, at one sample every
+        // mixer_cycles_per_sample cycles (prescaler 1).
+        REG_TM0CNT_L = 0x10000 - mixer_cycles_per_sample;
+        REG_TM0CNT_H = 0x0080;
+    } else {
+        start_isr_mixer();
+    }
+}
+
+
+static void audio_start()
+{
+    clear_music();
+
+    REG_SOUNDCNT_H = audio_soundcnt_h();
+    REG_SOUNDCNT_X = 0x0080; //turn sound chip on
+
+    start_isr_mixer();
+}
+
+
+static void enable_audio_frame_mixer(bool enabled)
+{
+    if (enabled == audio_frame_mixer) {
+        return;
+    }
+
+    modify_audio([&] {
+        audio_frame_mixer = enabled;
+        audio_restart();
+    });
+}
+
+
+static void enable_stereo_audio(bool enabled)
+{
+    if (enabled == audio_stereo) {
+        return;
+    }
+
+    modify_audio([&] {
+        audio_stereo = enabled;
+        audio_restart();
+    });
+}
+
+
 // We want our code to be resiliant to cartridges lacking an RTC chip. Run the
 // timer-based delta clock for a while, and make sure that the RTC also counted
 // up.
@@ -2265,6 +3362,11 @@ Platform::Platform()
     if (sram_test_result not_eq sram_test_const) {
         save_using_flash = true;
         info(*this, "SRAM write failed, falling back to FLASH");
+
+        // Recover the newest complete save, in case the power went out while
+        // the game was saving.
+        set_flash_bank(0);
+        flash_store.mount();
     }
 
     glyph_table.emplace(allocate_dynamic<GlyphTable>(*this));
@@ -2273,6 +3375,8 @@ Platform::Platform()
         fatal();
     }
 
+    resolve_charset_bins();
+
     // IMPORTANT: No calls to map_glyph() are allowed before reaching this
     // line. Otherwise, the glyph table has not yet been constructed.
 
@@ -2391,9 +3495,7 @@ static bool glyph_mode = false;
 void Platform::enable_glyph_mode(bool enabled)
 {
     if (enabled) {
-        for (auto& gm : ::glyph_table->obj_->mappings_) {
-            gm.reference_count_ = -1;
-        }
+        ::glyph_table->obj_->reset();
     }
     glyph_mode = enabled;
 }
@@ -2532,10 +3634,77 @@ static FontColorIndices font_color_indices()
 }
 
 
-// This code uses a lot of naive algorithms for searching the glyph mapping
-// table, potentially could be sped up, but we don't want to use any extra
-// memory, we've only got 256K to work with, and the table is big enough as it
-// is.
+static void upload_glyph(const PendingGlyph& glyph,
+                         const FontColorIndices& colors)
+{
+    // 8 x 8 x (4 bitsperpixel / 8 bitsperbyte)
+    constexpr int tile_size = vram_tile_size();
+
+    const auto& info = *charset_bins[glyph.bin_];
+
+    // We need to know which color to use as the background color, and which
+    // color to use as the foreground color. Each charset needs to store a
+    // reference pixel in the top left corner, representing the background
+    // color, otherwise, we have no way of knowing which pixel color to
+    // substitute where!
+    const auto bg_color = ((u8*)info.tile_data_)[0] & 0x0f;
+
+    u8 buffer[tile_size] = {0};
+
+    auto k_src = info.tile_data_ + (glyph.offset_ * tile_size) /
+                                       sizeof(decltype(info.tile_data_));
+
+    memcpy16(buffer, k_src, tile_size / 2);
+
+    for (int i = 0; i < tile_size; ++i) {
+        auto c = buffer[i];
+        if (c & bg_color) {
+            buffer[i] = colors.bg_;
+        } else {
+            buffer[i] = colors.fg_;
+        }
+        if (c & (bg_color << 4)) {
+            buffer[i] |= colors.bg_ << 4;
+        } else {
+            buffer[i] |= colors.fg_ << 4;
+        }
+    }
+
+    // FIXME: Why do these magic constants work? I wish better documentation
+    // existed for how the gba tile memory worked. I thought, that the tile
+    // size would be 32, because we have 4 bits per pixel, and 8x8 pixel
+    // tiles. But the actual number of bytes in a tile seems to be half of the
+    // expected number. Also, in vram, it seems like the tiles do seem to be 32
+    // bytes apart after all...
+    memcpy16((u8*)&MEM_SCREENBLOCKS[sbb_overlay_texture][0] +
+                 ((glyph.slot_ + glyph_start_offset) * tile_size),
+             buffer,
+             tile_size / 2);
+}
+
+
+static void flush_glyph_uploads()
+{
+    if (not ::glyph_table) {
+        return;
+    }
+
+    auto& table = *::glyph_table->obj_;
+
+    if (table.pending_count_ == 0) {
+        return;
+    }
+
+    const auto colors = font_color_indices();
+
+    for (int i = 0; i < table.pending_count_; ++i) {
+        upload_glyph(table.pending_[i], colors);
+    }
+
+    table.pending_count_ = 0;
+}
+
+
 TileDesc Platform::map_glyph(const utf8::Codepoint& glyph,
                              TextureCpMapper mapper)
 {
@@ -2543,11 +3712,10 @@ TileDesc Platform::map_glyph(const utf8::Codepoint& glyph,
         return bad_glyph;
     }
 
-    for (TileDesc tile = 0; tile < glyph_mapping_count; ++tile) {
-        auto& gm = ::glyph_table->obj_->mappings_[tile];
-        if (gm.valid() and gm.character_ == glyph) {
-            return glyph_start_offset + tile;
-        }
+    auto& table = *::glyph_table->obj_;
+
+    if (const int slot = table.lookup(glyph); slot not_eq -1) {
+        return glyph_start_offset + slot;
     }
 
     const auto mapping_info = mapper(glyph);
@@ -2556,18 +3724,10 @@ TileDesc Platform::map_glyph(const utf8::Codepoint& glyph,
         return bad_glyph;
     }
 
-    // NOTE: The linker or some other part of the toolchain seems to have
-    // trouble with large image file sizes, because when I try to include a
-    // single gigantic charset file in the project, I end up with garbage
-    // data. I believe that I've narrowed it down to some part of the build
-    // toolchain, because when I simply use a truncated charset file, everything
-    // works fine. A really bizzare issue.
-
-    const int binsize = (12000 / 8);
-    const int bin = mapping_info->offset_ / (12000 / 8);
+    const int bin = mapping_info->offset_ / charset_bin_size;
     int adjusted_offset = mapping_info->offset_;
     if (bin > 0) {
-        adjusted_offset -= binsize * bin;
+        adjusted_offset -= charset_bin_size * bin;
         adjusted_offset += 1 * bin; // +1 for the font index tile. FIXME: in
                                     // future versions, the script that
                                     // generates font tile mappings should be
@@ -2575,85 +3735,28 @@ TileDesc Platform::map_glyph(const utf8::Codepoint& glyph,
                                     // each charset bin.
     }
 
-    char buf[15];
-
-    StringBuffer<100> charset_name = "charset";
-    if (bin == 0) {
-        charset_name = "charset0";
-    } else {
-        english__to_string(bin, buf, 10);
-        charset_name += buf;
+    if (bin >= max_charset_bins or not charset_bins[bin]) {
+        return bad_glyph;
     }
 
+    const int t = table.assign(glyph);
+    if (t == -1) {
+        return bad_glyph;
+    }
 
-    for (auto& info : overlay_textures) {
-        if (str_cmp(charset_name.c_str(), info.name_) == 0) {
-            for (TileDesc t = 0; t < glyph_mapping_count; ++t) {
-                auto& gm = ::glyph_table->obj_->mappings_[t];
-                if (not gm.valid()) {
-                    gm.character_ = glyph;
-                    gm.reference_count_ = 0;
-
-                    // 8 x 8 x (4 bitsperpixel / 8 bitsperbyte)
-                    constexpr int tile_size = vram_tile_size();
-
-                    // u8 buffer[tile_size] = {0};
-                    // memcpy16(buffer,
-                    //          (u8*)&MEM_SCREENBLOCKS[sbb_overlay_texture][0] +
-                    //              ((81) * tile_size),
-                    //          tile_size / 2);
-
-                    const auto colors = font_color_indices();
-
-                    // We need to know which color to use as the background
-                    // color, and which color to use as the foreground
-                    // color. Each charset needs to store a reference pixel in
-                    // the top left corner, representing the background color,
-                    // otherwise, we have no way of knowing which pixel color to
-                    // substitute where!
-                    const auto bg_color = ((u8*)info.tile_data_)[0] & 0x0f;
-
-                    u8 buffer[tile_size] = {0};
-
-
-                    auto k_src =
-                        info.tile_data_ + (adjusted_offset * tile_size) /
-                                              sizeof(decltype(info.tile_data_));
-
-                    memcpy16(buffer, k_src, tile_size / 2);
-
-                    for (int i = 0; i < tile_size; ++i) {
-                        auto c = buffer[i];
-                        if (c & bg_color) {
-                            buffer[i] = colors.bg_;
-                        } else {
-                            buffer[i] = colors.fg_;
-                        }
-                        if (c & (bg_color << 4)) {
-                            buffer[i] |= colors.bg_ << 4;
-                        } else {
-                            buffer[i] |= colors.fg_ << 4;
-                        }
-                    }
+    PendingGlyph pending;
+    pending.offset_ = adjusted_offset;
+    pending.bin_ = bin;
+    pending.slot_ = t;
 
-                    // FIXME: Why do these magic constants work? I wish better
-                    // documentation existed for how the gba tile memory worked.
-                    // I thought, that the tile size would be 32, because we
-                    // have 4 bits per pixel, and 8x8 pixel tiles. But the
-                    // actual number of bytes in a tile seems to be half of the
-                    // expected number. Also, in vram, it seems like the tiles
-                    // do seem to be 32 bytes apart after all...
-                    memcpy16((u8*)&MEM_SCREENBLOCKS[sbb_overlay_texture][0] +
-                                 ((t + glyph_start_offset) * tile_size),
-                             buffer,
-                             tile_size / 2);
-
-                    return t + glyph_start_offset;
-                }
-            }
-        }
+    if (not table.enqueue(pending)) {
+        // Someone's printing a whole lot of new text in a single frame. Not
+        // much we can do, other than to write the queued glyphs now.
+        flush_glyph_uploads();
+        table.enqueue(pending);
     }
-    return bad_glyph;
+
+    return t + glyph_start_offset;
 }
 
 
@@ -2676,16 +3779,14 @@ void Platform::fill_overlay(u16 tile)
     const u32 fill_word = tile_info | (tile_info << 16);
 
     u32* const mem = (u32*)overlay_back_buffer;
-    overlay_back_buffer_changed = true;
+    overlay_dirty_rows = 0xffffffff;
 
     for (unsigned i = 0; i < sizeof(ScreenBlock) / (sizeof(u32)); ++i) {
         mem[i] = fill_word;
     }
 
     if (glyph_mode) {
-        for (auto& gm : ::glyph_table->obj_->mappings_) {
-            gm.reference_count_ = -1;
-        }
+        ::glyph_table->obj_->reset();
     }
 }
 
@@ -2706,11 +3807,6 @@ static void set_overlay_tile(Platform& pfrm, u16 x, u16 y, u16 val, int palette)
                                ->mappings_[old_tile - glyph_start_offset];
                 if (gm.valid()) {
                     gm.reference_count_ -= 1;
-
-                    if (gm.reference_count_ == 0) {
-                        gm.reference_count_ = -1;
-                        gm.character_ = 0;
-                    }
                 } else {
                     error(pfrm,
                           "existing tile is a glyph, but has no"
@@ -2734,8 +3830,12 @@ static void set_overlay_tile(Platform& pfrm, u16 x, u16 y, u16 val, int palette)
         }
     }
 
-    overlay_back_buffer[x + y * 32] = val | SE_PALBANK(palette);
-    overlay_back_buffer_changed = true;
+    auto& entry = overlay_back_buffer[x + y * 32];
+    const u16 new_entry = val | SE_PALBANK(palette);
+    if (entry not_eq new_entry) {
+        entry = new_entry;
+        overlay_dirty_rows |= 1u << y;
+    }
 }
 
 
@@ -2833,17 +3933,15 @@ void Platform::set_tile(Layer layer, u16 x, u16 y, u16 val)
         if (x > 63 or y > 63) {
             return;
         }
+        val |= tile_palbank(tile1_banks, tile1_palettes, val);
         if (x < 32 and y < 32) {
-            MEM_SCREENBLOCKS[sbb_t1_tiles][x + y * 32] = val | SE_PALBANK(2);
+            MEM_SCREENBLOCKS[sbb_t1_tiles][x + y * 32] = val;
         } else if (y < 32) {
-            MEM_SCREENBLOCKS[sbb_t1_tiles + 1][(x - 32) + y * 32] =
-                val | SE_PALBANK(2);
+            MEM_SCREENBLOCKS[sbb_t1_tiles + 1][(x - 32) + y * 32] = val;
         } else if (x < 32) {
-            MEM_SCREENBLOCKS[sbb_t1_tiles + 2][x + (y - 32) * 32] =
-                val | SE_PALBANK(2);
+            MEM_SCREENBLOCKS[sbb_t1_tiles + 2][x + (y - 32) * 32] = val;
         } else {
-            MEM_SCREENBLOCKS[sbb_t1_tiles + 3][(x - 32) + (y - 32) * 32] =
-                val | SE_PALBANK(2);
+            MEM_SCREENBLOCKS[sbb_t1_tiles + 3][(x - 32) + (y - 32) * 32] = val;
         }
         break;
 
@@ -2851,6 +3949,7 @@ void Platform::set_tile(Layer layer, u16 x, u16 y, u16 val)
         if (x > 63 or y > 63) {
             return;
         }
+        val |= tile_palbank(tile0_banks, tile0_palettes, val);
         if (x < 32 and y < 32) {
             MEM_SCREENBLOCKS[sbb_t0_tiles][x + y * 32] = val;
         } else if (y < 32) {
@@ -2866,6 +3965,7 @@ void Platform::set_tile(Layer layer, u16 x, u16 y, u16 val)
         if (x > 31 or y > 31) {
             return;
         }
+        val |= tile_palbank(tile0_banks, tile0_palettes, val);
         MEM_SCREENBLOCKS[sbb_bg_tiles][x + y * 32] = val;
         break;
     }
@@ -0,0 +1,194 @@
+#pragma once
+
+
+#include "gba_platform_soundcontext.hpp"
+
+
+// IMA-ADPCM stores each sample as a four bit delta, scaled by a step size that
+// adapts to the signal, so compressed music takes half as much space as our
+// usual 8-bit pcm, and costs half as many reads over the slow cartridge bus.
+// build.lua encodes the audio files (see encode_adpcm()), and the engine
+// decodes music a little bit ahead of the mixer, into a ring buffer in IWRAM.
+// Nothing in this file touches the hardware, so the decoder can be compiled and
+// tested on any platform.
+//
+// File layout (little-endian):
+//
+// char magic[4]     - "IMA4"
+// u32 sample_count
+// u16 block_samples - always adpcm_block_samples
+// u16 reserved
+// blocks[...]
+//
+// Each block starts with the decoder state, an s16 predictor, a u8 step index,
+// and a padding byte, followed by block_samples nibbles, low nibble first. The
+// last block is padded out to the full block size. Because each block carries
+// its own decoder state, we can start decoding at any block, which makes
+// seeking and looping cheap.
+static constexpr int adpcm_block_samples = 512;
+static constexpr int adpcm_block_header_bytes = 4;
+static constexpr int adpcm_block_bytes =
+    adpcm_block_header_bytes + adpcm_block_samples / 2;
+static constexpr int adpcm_file_header_bytes = 12;
+
+
+static const s16 adpcm_step_table[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+
+static const s8 adpcm_index_table[16] =
+    {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+
+struct AdpcmStream {
+    const u8* blocks_ = nullptr;
+    u32 sample_count_ = 0;
+
+    // The next sample to decode. Wraps back to zero at the end of the stream,
+    // because music loops.
+    u32 position_ = 0;
+
+    s32 predictor_ = 0;
+    s32 step_index_ = 0;
+};
+
+
+// Returns false if the data does not look like an adpcm file.
+inline bool adpcm_open(AdpcmStream& stream, const u8* data, u32 size)
+{
+    if (size < adpcm_file_header_bytes or data[0] not_eq 'I' or
+        data[1] not_eq 'M' or data[2] not_eq 'A' or data[3] not_eq '4') {
+        return false;
+    }
+
+    const u32 sample_count = data[4] | (data[5] << 8) | (data[6] << 16) |
+                             (u32(data[7]) << 24);
+    const u32 block_samples = data[8] | (data[9] << 8);
+
+    const u32 blocks = (sample_count + adpcm_block_samples - 1) /
+                       adpcm_block_samples;
+
+    if (block_samples not_eq adpcm_block_samples or sample_count == 0 or
+        size < adpcm_file_header_bytes + blocks * adpcm_block_bytes) {
+        return false;
+    }
+
+    stream.blocks_ = data + adpcm_file_header_bytes;
+    stream.sample_count_ = sample_count;
+    stream.position_ = 0;
+
+    return true;
+}
+
+
+AUDIO_INLINE s32 adpcm_decode_nibble(AdpcmStream& stream, u8 nibble)
+{
+    const s32 step = adpcm_step_table[stream.step_index_];
+
+    s32 diff = step >> 3;
+    if (nibble & 1) {
+        diff += step >> 2;
+    }
+    if (nibble & 2) {
+        diff += step >> 1;
+    }
+    if (nibble & 4) {
+        diff += step;
+    }
+
+    s32 predictor = stream.predictor_;
+    if (nibble & 8) {
+        predictor -= diff;
+        if (predictor < -32768) {
+            predictor = -32768;
+        }
+    } else {
+        predictor += diff;
+        if (predictor > 32767) {
+            predictor = 32767;
+        }
+    }
+    stream.predictor_ = predictor;
+
+    s32 index = stream.step_index_ + adpcm_index_table[nibble];
+    if (index < 0) {
+        index = 0;
+    } else if (index > 88) {
+        index = 88;
+    }
+    stream.step_index_ = index;
+
+    return predictor;
+}
+
+
+// Decode the next count samples of the stream into out.
+AUDIO_INLINE void
+adpcm_decode(AdpcmStream& stream, AudioSample* out, int count)
+{
+    while (count) {
+        if (stream.position_ >= stream.sample_count_) {
+            stream.position_ = 0;
+        }
+
+        const u32 block_index = stream.position_ / adpcm_block_samples;
+        u32 offset = stream.position_ % adpcm_block_samples;
+
+        const u8* block = stream.blocks_ + block_index * adpcm_block_bytes;
+
+        if (offset == 0) {
+            stream.predictor_ = s16(block[0] | (block[1] << 8));
+            stream.step_index_ = block[2];
+            if (stream.step_index_ > 88) {
+                stream.step_index_ = 88;
+            }
+        }
+
+        int n = adpcm_block_samples - offset;
+        if (u32(n) > stream.sample_count_ - stream.position_) {
+            n = stream.sample_count_ - stream.position_;
+        }
+        if (n > count) {
+            n = count;
+        }
+
+        const u8* nibbles = block + adpcm_block_header_bytes;
+
+        for (int i = 0; i < n; ++i, ++offset) {
+            const u8 byte = nibbles[offset >> 1];
+            const u8 nibble = (offset & 1) ? byte >> 4 : byte & 0x0f;
+
+            *(out++) = adpcm_decode_nibble(stream, nibble) >> 8;
+        }
+
+        stream.position_ += n;
+        count -= n;
+    }
+}
+
+
+// Seek to a sample. We can only start decoding at the beginning of a block, so
+// we decode and throw away the samples preceding the target.
+AUDIO_INLINE void adpcm_seek(AdpcmStream& stream, u32 sample)
+{
+    sample %= stream.sample_count_;
+
+    stream.position_ = sample - sample % adpcm_block_samples;
+
+    AudioSample discard[32];
+    while (stream.position_ < sample) {
+        int n = sample - stream.position_;
+        if (n > 32) {
+            n = 32;
+        }
+        adpcm_decode(stream, discard, n);
+    }
+}
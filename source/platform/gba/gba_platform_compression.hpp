@@ -0,0 +1,112 @@
+#pragma once
+
+
+#include "filesystem.hpp"
+#include "number/numeric.hpp"
+
+
+// build.lua can compress files in the lz77 and run-length formats understood
+// by the gba bios, so that the engine can decompress them with a single
+// system call, straight into vram or ram. build.lua records the format in the
+// last byte of the file's bundle header (see filesystem.cpp), which the
+// filesystem hands to us as FileData::compression_. The file starts with
+// padding up to the next word boundary, because the bios wants word-aligned
+// data, and the bundle does not align files to words. Then comes the bios
+// data, which starts with a u32 header: the format in the low byte (0x10 for
+// lz77, 0x30 for run-length, the same values that the bundle header uses), and
+// the decompressed size in the upper 24 bits.
+//
+// The bios does the real work on the gba. The decoders in this file produce
+// the same output, so that the desktop platform, and tests and benchmarks on
+// the host, can read compressed files too.
+enum class Compression { none, lz77, rle };
+
+
+inline Compression compression_of(const Filesystem::FileData& file)
+{
+    if (file.size_ < 4) {
+        return Compression::none;
+    }
+
+    switch (file.compression_) {
+    case 0x10:
+        return Compression::lz77;
+
+    case 0x30:
+        return Compression::rle;
+    }
+
+    return Compression::none;
+}
+
+
+// Returns the bios data of a compressed file.
+inline const u8* compressed_stream(const Filesystem::FileData& file)
+{
+    return (const u8*)(((uintptr_t)file.data_ + 3) & ~uintptr_t(3));
+}
+
+
+inline u32 decompressed_size(const u8* stream)
+{
+    return stream[1] | (stream[2] << 8) | (stream[3] << 16);
+}
+
+
+// Lz77: a flag byte describes the next eight blocks, most significant bit
+// first. A clear bit means a literal byte. A set bit means a two byte
+// back-reference: the top four bits hold the length minus three, and the
+// remaining twelve bits the distance minus one.
+inline void lz77_decompress(const u8* stream, u8* out)
+{
+    const u32 size = decompressed_size(stream);
+    const u8* in = stream + 4;
+
+    u32 written = 0;
+    while (written < size) {
+        const u8 flags = *in++;
+
+        for (int i = 0; i < 8 and written < size; ++i) {
+            if (flags & (0x80 >> i)) {
+                const u32 length = (in[0] >> 4) + 3;
+                const u32 distance = (((in[0] & 0xf) << 8) | in[1]) + 1;
+                in += 2;
+
+                for (u32 j = 0; j < length and written < size; ++j) {
+                    out[written] = out[written - distance];
+                    ++written;
+                }
+            } else {
+                out[written++] = *in++;
+            }
+        }
+    }
+}
+
+
+// Run-length: a flag byte with the high bit set means a run of (flag & 0x7f)
+// + 3 copies of the next byte. Otherwise, (flag & 0x7f) + 1 literal bytes
+// follow.
+inline void rle_decompress(const u8* stream, u8* out)
+{
+    const u32 size = decompressed_size(stream);
+    const u8* in = stream + 4;
+
+    u32 written = 0;
+    while (written < size) {
+        const u8 flag = *in++;
+
+        if (flag & 0x80) {
+            const u32 length = (flag & 0x7f) + 3;
+            const u8 value = *in++;
+            for (u32 j = 0; j < length and written < size; ++j) {
+                out[written++] = value;
+            }
+        } else {
+            const u32 length = (flag & 0x7f) + 1;
+            for (u32 j = 0; j < length and written < size; ++j) {
+                out[written++] = *in++;
+            }
+        }
+    }
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+
+#include "gba_platform_savestore.hpp"
+
+
+// A simulated flash chip, which understands the same command sequences as the
+// real thing, so that the save store runs unmodified on the host (see
+// gba_platform_savestore.hpp). The simulation keeps count of the bytes
+// programmed and the sectors erased, so that we can measure the write
+// amplification and the latency of the save store. The desktop platform saves
+// through it, and the host tests use it to check the store's recovery from
+// power cuts.
+class SimulatedFlash {
+public:
+    // Rough timings for a typical gba flash chip, from the datasheets.
+    static const int program_time = 20;  // microseconds per byte
+    static const int erase_time = 25000; // microseconds per sector
+
+    static constexpr u32 size = save_sector_size * save_sector_count;
+
+
+    SimulatedFlash()
+    {
+        for (auto& byte : memory_) {
+            byte = 0xff;
+        }
+    }
+
+
+    u8 read(u32 offset) const
+    {
+        return memory_[offset % size];
+    }
+
+
+    void write(u32 offset, u8 value)
+    {
+        offset %= size;
+
+        switch (state_) {
+        case State::ready:
+        case State::erase_ready:
+            next_state(offset == 0x5555 and value == 0xaa, State::unlocked_1);
+            break;
+
+        case State::unlocked_1:
+            next_state(offset == 0x2aaa and value == 0x55, State::unlocked_2);
+            break;
+
+        case State::unlocked_2:
+            if (erase_) {
+                erase_ = false;
+                if (value == 0x30) {
+                    erase(offset);
+                } else if (offset == 0x5555 and value == 0x10) {
+                    for (u32 s = 0; s < save_sector_count; ++s) {
+                        erase(s * save_sector_size);
+                    }
+                } else {
+                    ++stray_writes_;
+                }
+                state_ = State::ready;
+            } else if (offset not_eq 0x5555) {
+                next_state(false, State::ready);
+            } else if (value == 0xa0) {
+                state_ = State::program;
+            } else if (value == 0x80) {
+                erase_ = true;
+                state_ = State::erase_ready;
+            } else {
+                // Bank switching, chip id mode, etc. Nothing to simulate.
+                state_ = State::ready;
+            }
+            break;
+
+        case State::program:
+            // Programming can only clear bits.
+            memory_[offset] &= value;
+            ++bytes_programmed_;
+            state_ = State::ready;
+            break;
+        }
+    }
+
+
+    // The raw contents of the chip, e.g. for keeping them in a file.
+    u8* data()
+    {
+        return memory_;
+    }
+
+
+    // Estimated time spent programming and erasing, in microseconds.
+    u64 busy_time() const
+    {
+        return u64(bytes_programmed_) * program_time +
+               u64(sectors_erased_) * erase_time;
+    }
+
+
+    u32 bytes_programmed_ = 0;
+    u32 sectors_erased_ = 0;
+    u32 sector_erases_[save_sector_count] = {};
+    u32 stray_writes_ = 0;
+
+private:
+    enum class State {
+        ready,
+        unlocked_1,
+        unlocked_2,
+        program,
+        erase_ready,
+    };
+
+
+    void next_state(bool expected, State state)
+    {
+        if (expected) {
+            state_ = state;
+        } else {
+            ++stray_writes_;
+            erase_ = false;
+            state_ = State::ready;
+        }
+    }
+
+
+    void erase(u32 offset)
+    {
+        const u32 start = offset - offset % save_sector_size;
+        for (u32 i = 0; i < save_sector_size; ++i) {
+            memory_[start + i] = 0xff;
+        }
+        ++sectors_erased_;
+        ++sector_erases_[start / save_sector_size];
+    }
+
+
+    State state_ = State::ready;
+    bool erase_ = false;
+    u8 memory_[size];
+};
+
+
+struct SimulatedFlashBus {
+    SimulatedFlash* flash_;
+
+    u8 read(u32 offset)
+    {
+        return flash_->read(offset);
+    }
+
+    void write(u32 offset, u8 value)
+    {
+        flash_->write(offset, value);
+    }
+};
@@ -0,0 +1,216 @@
+#pragma once
+
+
+#include "number/int.h"
+#include "unicode.hpp"
+
+
+// Bookkeeping for the glyphs that the overlay maps into vram on demand. Text
+// printing looks up every character that it draws, so the table needs to stay
+// fast on dialog-heavy screens: codepoints hash into an open addressing table,
+// and once all of the slots fill up, we evict the least recently used glyph
+// that nothing on screen refers to.
+
+
+struct GlyphMapping {
+    utf8::Codepoint character_;
+
+    // -1 represents unassigned. Mapping a tile into memory sets the reference
+    //  count to zero. When a call to Platform::set_tile reduces the reference
+    //  count back to zero, the glyph stays cached in vram, and becomes a
+    //  candidate for eviction the next time that we need to map a new glyph.
+    s16 reference_count_ = -1;
+
+    // Stamp for lru eviction. Only sixteen bits, to keep the table small
+    // enough to fit in a scratch buffer, so compare ages, not stamps.
+    u16 last_used_ = 0;
+
+    bool valid() const
+    {
+        return reference_count_ > -1;
+    }
+};
+
+
+constexpr const auto glyph_start_offset = 1;
+constexpr const auto glyph_mapping_count = 78;
+
+
+// A glyph that we've assigned to a slot, but have not yet copied into vram. We
+// batch the copies, and do them all at once during the next call to
+// Screen::display().
+struct PendingGlyph {
+    u16 offset_; // tile offset within the charset bin
+    u8 bin_;
+    u8 slot_;
+};
+
+
+struct GlyphTable {
+    static constexpr int table_size = 128;
+    static constexpr u8 empty = 0xff;
+    static constexpr int max_pending = 32;
+
+    GlyphMapping mappings_[glyph_mapping_count];
+
+    // Open addressing table, mapping codepoints to slots in mappings_.
+    u8 table_[table_size];
+
+    PendingGlyph pending_[max_pending];
+    int pending_count_ = 0;
+
+    u16 clock_ = 0;
+
+
+    GlyphTable()
+    {
+        reset();
+    }
+
+
+    void reset()
+    {
+        for (auto& gm : mappings_) {
+            gm.reference_count_ = -1;
+            gm.character_ = 0;
+        }
+
+        for (auto& entry : table_) {
+            entry = empty;
+        }
+
+        pending_count_ = 0;
+    }
+
+
+    static int hash(utf8::Codepoint cp)
+    {
+        return (cp * 2654435761u) >> (32 - 7);
+    }
+
+
+    int find(utf8::Codepoint cp) const
+    {
+        for (int i = hash(cp);; i = (i + 1) & (table_size - 1)) {
+            if (table_[i] == empty) {
+                return -1;
+            } else if (mappings_[table_[i]].character_ == cp) {
+                return i;
+            }
+        }
+    }
+
+
+    void insert(u8 slot)
+    {
+        int i = hash(mappings_[slot].character_);
+        while (table_[i] not_eq empty) {
+            i = (i + 1) & (table_size - 1);
+        }
+        table_[i] = slot;
+    }
+
+
+    // Backward-shift deletion, same as the sprite cache.
+    void erase(int i)
+    {
+        int j = i;
+        while (true) {
+            j = (j + 1) & (table_size - 1);
+            if (table_[j] == empty) {
+                break;
+            }
+            const int k = hash(mappings_[table_[j]].character_);
+            const bool movable =
+                (j > i) ? (k <= i or k > j) : (k <= i and k > j);
+            if (movable) {
+                table_[i] = table_[j];
+                i = j;
+            }
+        }
+        table_[i] = empty;
+    }
+
+
+    // Pick a slot for a new glyph: an unassigned slot if we have one,
+    // otherwise the least recently used glyph that nothing on screen refers
+    // to. Returns -1 if every slot is in use.
+    int victim() const
+    {
+        int result = -1;
+        int oldest = -1;
+        for (int t = 0; t < glyph_mapping_count; ++t) {
+            const auto& gm = mappings_[t];
+            if (not gm.valid()) {
+                return t;
+            } else if (gm.reference_count_ == 0) {
+                const int age = u16(clock_ - gm.last_used_);
+                if (age > oldest) {
+                    oldest = age;
+                    result = t;
+                }
+            }
+        }
+        return result;
+    }
+
+
+    // Returns the slot holding a codepoint, or -1, and marks the glyph as
+    // recently used.
+    int lookup(utf8::Codepoint cp)
+    {
+        ++clock_;
+
+        if (const int i = find(cp); i not_eq -1) {
+            const auto slot = table_[i];
+            mappings_[slot].last_used_ = clock_;
+            return slot;
+        }
+        return -1;
+    }
+
+
+    // Evicts a glyph to make room for a new codepoint. Returns the slot, or -1
+    // if every glyph is on screen. The caller still needs to queue the slot's
+    // graphics for upload.
+    int assign(utf8::Codepoint cp)
+    {
+        const int t = victim();
+        if (t == -1) {
+            return -1;
+        }
+
+        auto& gm = mappings_[t];
+        if (gm.valid()) {
+            erase(find(gm.character_));
+        }
+
+        gm.character_ = cp;
+        gm.reference_count_ = 0;
+        gm.last_used_ = clock_;
+        insert(t);
+
+        return t;
+    }
+
+
+    // Queues a glyph upload. If we evicted a glyph that hadn't been copied into
+    // vram yet, we replace its queue entry. Returns false if the queue is
+    // full, in which case the caller should flush it and try again.
+    bool enqueue(const PendingGlyph& pending)
+    {
+        for (int i = 0; i < pending_count_; ++i) {
+            if (pending_[i].slot_ == pending.slot_) {
+                pending_[i] = pending;
+                return true;
+            }
+        }
+
+        if (pending_count_ == max_pending) {
+            return false;
+        }
+
+        pending_[pending_count_++] = pending;
+        return true;
+    }
+};
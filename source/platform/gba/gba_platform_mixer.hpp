@@ -0,0 +1,205 @@
+#pragma once
+
+
+#include "gba_platform_soundcontext.hpp"
+#include "util.hpp"
+
+
+// The frame mixer mixes a whole frame's worth of audio at once, during the
+// vblank, rather than mixing four samples at a time in a timer interrupt. The
+// sound dma then feeds the samples to the direct sound fifo, without any help
+// from the cpu. Nothing in this file touches the hardware, so the mixing code
+// can be compiled and tested on any platform.
+//
+// The gba's timers only accept whole numbers of cycles, and we need to mix
+// exactly as many samples as the hardware plays during a frame, otherwise the
+// mixer would slowly drift out of sync with the dma. A frame lasts 280896
+// cycles, which divides evenly into 304 samples of 924 cycles each, i.e. about
+// 18157Hz. 304 is also a multiple of sixteen, the number of bytes that the
+// sound dma copies into the fifo at a time, so the dma finishes reading a
+// buffer right when we point it at the next one.
+static constexpr int mixer_frame_samples = 304;
+static constexpr int mixer_cycles_per_sample = 924;
+
+
+// Our sound files are 16kHz, so we need to resample them as we mix. The step is
+// the number of input samples per output sample, in 16.16 fixed point.
+static constexpr u32 mixer_resample_step =
+    (16000ull << 16) * mixer_cycles_per_sample / (1 << 24);
+
+
+// The number of samples that the frame mixer plays in the given time. The cpu
+// runs at 2^24 cycles per second.
+inline u32 mixer_samples(u32 microseconds)
+{
+    return u64(microseconds) * (1 << 24) /
+           (u64(mixer_cycles_per_sample) * 1000000);
+}
+
+
+AUDIO_INLINE s32 clamp_sample(s32 value)
+{
+    if (value > 127) {
+        return 127;
+    } else if (value < -128) {
+        return -128;
+    }
+    return value;
+}
+
+
+AUDIO_INLINE void
+advance_music(s32& position, u32& fraction, s32 length, u32 step)
+{
+    fraction += step;
+    position += fraction >> 16;
+    fraction &= 0xffff;
+
+    if (UNLIKELY(position >= length)) {
+        position = 0;
+    }
+}
+
+
+// Mix four samples of the current and the previous music track, and step the
+// fade.
+AUDIO_INLINE void mix_crossfade(SoundContext& ctx,
+                                s32 acc[4],
+                                s32& music_pos,
+                                u32& music_fraction,
+                                u32 step)
+{
+    const s32 in = ctx.fade_level >> 16;
+    const s32 out = audio_full_volume - in;
+
+    s32 fade_pos = ctx.fade_track_pos;
+    u32 fade_fraction = ctx.fade_track_fraction;
+
+    for (int j = 0; j < 4; ++j) {
+        const s32 sample = ctx.music_track[music_pos] * in +
+                           ctx.fade_track[fade_pos] * out;
+
+        acc[j] = (sample * ctx.music_volume) >> audio_volume_shift;
+
+        advance_music(music_pos, music_fraction, ctx.music_track_length, step);
+        advance_music(fade_pos, fade_fraction, ctx.fade_track_length, step);
+    }
+
+    ctx.fade_track_pos = fade_pos;
+    ctx.fade_track_fraction = fade_fraction;
+
+    ctx.fade_level += ctx.fade_step;
+    if (ctx.fade_level >= u32(audio_full_volume) << 16) {
+        ctx.fade_track = nullptr;
+    }
+}
+
+
+// Clamp four accumulated samples back into eight bits, and write them with a
+// single store.
+AUDIO_INLINE void pack_samples(const s32 acc[4], AudioSample* out)
+{
+    u32 packed = 0;
+    for (int j = 0; j < 4; ++j) {
+        const u8 sample = clamp_sample(acc[j] >> audio_volume_shift);
+        packed |= u32(sample) << (j * 8);
+    }
+
+    *reinterpret_cast<u32*>(out) = packed;
+}
+
+
+// Mix count samples of the music track and the active sounds into out. Count
+// must be a multiple of four, and out must be word-aligned: we mix four samples
+// at a time, with enough headroom that overlapping sounds don't wrap around,
+// then clamp the results back into eight bits and write them with a single
+// store. Channels that run out of samples stop playing, the music track loops.
+//
+// The stereo mixer writes the left channel to out, and the right channel to
+// out_right. Music plays centered, and sounds use their left and right
+// volumes, instead of the mono volume.
+template <bool stereo>
+AUDIO_INLINE void mix_audio(SoundContext& ctx,
+                            AudioSample* out,
+                            AudioSample* out_right,
+                            int count,
+                            u32 step)
+{
+    auto music = ctx.music_track;
+    const s32 music_volume = ctx.music_volume;
+    s32 music_pos = ctx.music_track_pos;
+    u32 music_fraction = ctx.music_track_fraction;
+
+    for (int i = 0; i < count; i += 4) {
+        s32 acc[4];
+        s32 acc_right[4];
+
+        // NOTE: When no music is playing, the context holds a track of empty
+        // samples, so we don't need to check for a null music track here.
+        if (UNLIKELY(ctx.fade_track not_eq nullptr)) {
+            mix_crossfade(ctx, acc, music_pos, music_fraction, step);
+        } else {
+            for (int j = 0; j < 4; ++j) {
+                acc[j] = music[music_pos] * music_volume;
+                advance_music(
+                    music_pos, music_fraction, ctx.music_track_length, step);
+            }
+        }
+
+        if (stereo) {
+            for (int j = 0; j < 4; ++j) {
+                acc_right[j] = acc[j];
+            }
+        }
+
+        for (auto& ch : ctx.channels) {
+            if (ch.data_ == nullptr) {
+                continue;
+            }
+
+            for (int j = 0; j < 4; ++j) {
+                if (UNLIKELY(ch.position_ >= ch.length_)) {
+                    ch.data_ = nullptr;
+                    break;
+                }
+
+                const s32 sample = ch.data_[ch.position_];
+                if (stereo) {
+                    acc[j] += sample * ch.left_volume_;
+                    acc_right[j] += sample * ch.right_volume_;
+                } else {
+                    acc[j] += sample * ch.volume_;
+                }
+
+                const u32 fraction = ch.fraction_ + step;
+                ch.position_ += fraction >> 16;
+                ch.fraction_ = fraction & 0xffff;
+            }
+        }
+
+        pack_samples(acc, out + i);
+        if (stereo) {
+            pack_samples(acc_right, out_right + i);
+        }
+    }
+
+    ctx.music_track_pos = music_pos;
+    ctx.music_track_fraction = music_fraction;
+}
+
+
+AUDIO_INLINE void
+mix_audio_frame(SoundContext& ctx, AudioSample* out, int count, u32 step)
+{
+    mix_audio<false>(ctx, out, nullptr, count, step);
+}
+
+
+AUDIO_INLINE void mix_audio_frame_stereo(SoundContext& ctx,
+                                         AudioSample* left,
+                                         AudioSample* right,
+                                         int count,
+                                         u32 step)
+{
+    mix_audio<true>(ctx, left, right, count, step);
+}
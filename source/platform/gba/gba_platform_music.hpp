@@ -0,0 +1,245 @@
+#pragma once
+
+
+#include "gba_platform_adpcm.hpp"
+
+
+// Music plays from ring buffers, which we refill once per frame, a little bit
+// ahead of the mixer. Filling the ring buffer is where we handle everything
+// that makes music complicated: decoding adpcm, loop points, and switching to a
+// queued track at the exact sample where the previous one ends. The mixer just
+// loops over the ring buffer, without knowing anything about the track.
+//
+// The MusicPlayer owns two ring buffers (decks), so that we can prepare a new
+// track in the idle deck while the current one keeps playing, and crossfade
+// between the two. Nothing in this file touches the hardware, so the music
+// player works on any platform.
+static constexpr int music_ring_size = 1024;
+
+
+// A music track, either raw 8-bit pcm, or adpcm.
+struct MusicSource {
+    // Null for adpcm tracks.
+    const AudioSample* pcm_ = nullptr;
+    AdpcmStream adpcm_;
+
+    u32 length_ = 0;
+
+    // Raw pcm only, adpcm streams keep track of their own position.
+    u32 position_ = 0;
+
+    // Where the track starts over, once it reaches the end.
+    u32 loop_start_ = 0;
+
+
+    bool open(const u8* data, u32 size)
+    {
+        if (adpcm_open(adpcm_, data, size)) {
+            pcm_ = nullptr;
+            length_ = adpcm_.sample_count_;
+        } else {
+            pcm_ = reinterpret_cast<const AudioSample*>(data);
+            length_ = size;
+        }
+
+        position_ = 0;
+        loop_start_ = 0;
+
+        return length_ not_eq 0;
+    }
+
+
+    AUDIO_INLINE void seek(u32 sample)
+    {
+        sample %= length_;
+
+        if (pcm_) {
+            position_ = sample;
+        } else {
+            adpcm_seek(adpcm_, sample);
+        }
+    }
+
+
+    AUDIO_INLINE u32 position() const
+    {
+        return pcm_ ? position_ : adpcm_.position_;
+    }
+
+
+    // Does not handle the end of the track, see MusicDeck::read().
+    AUDIO_INLINE void read(AudioSample* out, int count)
+    {
+        if (pcm_) {
+            for (int i = 0; i < count; ++i) {
+                out[i] = pcm_[position_ + i];
+            }
+            position_ += count;
+        } else {
+            adpcm_decode(adpcm_, out, count);
+        }
+    }
+};
+
+
+struct MusicDeck {
+    MusicSource source_;
+
+    // Starts playing when source_ reaches its end, instead of looping.
+    MusicSource queued_;
+    bool has_queued_ = false;
+
+    int write_ = 0;
+    alignas(4) AudioSample ring_[music_ring_size];
+
+
+    AUDIO_INLINE void read(AudioSample* out, int count)
+    {
+        while (count) {
+            int n = source_.length_ - source_.position();
+            if (n > count) {
+                n = count;
+            }
+
+            source_.read(out, n);
+            out += n;
+            count -= n;
+
+            if (source_.position() >= source_.length_) {
+                if (has_queued_) {
+                    source_ = queued_;
+                    has_queued_ = false;
+                } else {
+                    source_.seek(source_.loop_start_);
+                }
+            }
+        }
+    }
+
+
+    // Fill the ring buffer up to, but not including, the mixer's read
+    // position. The mixer only ever moves the read position forward, so the
+    // free space can only grow while we're filling.
+    AUDIO_INLINE void fill(int read_pos)
+    {
+        int free = (read_pos - write_ - 1) & (music_ring_size - 1);
+
+        while (free) {
+            int count = music_ring_size - write_;
+            if (count > free) {
+                count = free;
+            }
+
+            read(ring_ + write_, count);
+
+            write_ = (write_ + count) & (music_ring_size - 1);
+            free -= count;
+        }
+    }
+};
+
+
+class MusicPlayer {
+public:
+    bool playing() const
+    {
+        return playing_;
+    }
+
+
+    // Load a track into the idle deck, and fill the deck's ring buffer. Safe
+    // to call with interrupts enabled, because neither the mixer nor fill()
+    // touch the idle deck. But make sure to call cancel_fade() first, because
+    // during a crossfade, the previous track plays from the idle deck.
+    void load(const MusicSource& source)
+    {
+        auto& deck = decks_[not current_];
+        deck.source_ = source;
+        deck.has_queued_ = false;
+        deck.write_ = 0;
+        deck.fill(0);
+    }
+
+
+    // Switch to the track prepared by load(), crossfading from the current
+    // track over fade_samples samples, or cutting over immediately if
+    // fade_samples is zero. Call with audio interrupts masked.
+    void start(SoundContext& ctx, u32 fade_samples)
+    {
+        if (playing_ and fade_samples) {
+            ctx.fade_track = ctx.music_track;
+            ctx.fade_track_length = ctx.music_track_length;
+            ctx.fade_track_pos = ctx.music_track_pos;
+            ctx.fade_track_fraction = ctx.music_track_fraction;
+
+            // The mixer steps the fade once every four samples.
+            u32 steps = fade_samples / 4;
+            if (steps == 0) {
+                steps = 1;
+            }
+            ctx.fade_level = 0;
+            ctx.fade_step = (u32(audio_full_volume) << 16) / steps;
+
+            fading_ = true;
+        }
+
+        current_ = not current_;
+        playing_ = true;
+
+        ctx.music_track = decks_[current_].ring_;
+        ctx.music_track_length = music_ring_size;
+        ctx.music_track_pos = 0;
+        ctx.music_track_fraction = 0;
+    }
+
+
+    // Play a track after the current track reaches its end. Call with audio
+    // interrupts masked.
+    void queue(const MusicSource& source)
+    {
+        auto& deck = decks_[current_];
+        deck.queued_ = source;
+        deck.has_queued_ = true;
+    }
+
+
+    // Call with audio interrupts masked.
+    void cancel_fade(SoundContext& ctx)
+    {
+        ctx.fade_track = nullptr;
+        fading_ = false;
+    }
+
+
+    // Call with audio interrupts masked. Afterwards, point the sound context
+    // at some silence.
+    void stop(SoundContext& ctx)
+    {
+        cancel_fade(ctx);
+        playing_ = false;
+    }
+
+
+    // Call once per frame, before mixing.
+    AUDIO_INLINE void fill(SoundContext& ctx)
+    {
+        if (fading_) {
+            if (ctx.fade_track == nullptr) {
+                // The mixer finished the crossfade.
+                fading_ = false;
+            } else {
+                decks_[not current_].fill(ctx.fade_track_pos);
+            }
+        }
+
+        if (playing_) {
+            decks_[current_].fill(ctx.music_track_pos);
+        }
+    }
+
+private:
+    MusicDeck decks_[2];
+    int current_ = 0;
+    bool playing_ = false;
+    bool fading_ = false;
+};
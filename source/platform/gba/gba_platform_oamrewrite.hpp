@@ -0,0 +1,21 @@
+#pragma once
+
+
+#include "number/int.h"
+
+
+// A scheduled write to object attribute memory, applied by the hblank handler
+// when multiplexing sprites. The platform terminates each frame's list of
+// rewrites with an entry whose line_ is past the bottom of the screen.
+struct OamRewrite {
+    u8 line_;
+    u8 slot_;
+    u16 attr_[3];
+};
+
+
+static constexpr u8 oam_rewrite_sentinel_line = 0xff;
+
+
+// The next rewrite to apply. Reset during each vblank.
+extern const OamRewrite* volatile oam_rewrite_cursor;
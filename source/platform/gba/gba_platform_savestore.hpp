@@ -0,0 +1,556 @@
+#pragma once
+
+
+#include "number/numeric.hpp"
+
+
+// Flash memory can only clear bits. To set them again, we have to erase a whole
+// 4KB sector, and each sector survives a limited number of erases. So rather
+// than rewriting the save data in place, the save store appends it to a log:
+// we split the save data into blocks, and when the game saves, we write a new
+// record for each block that changed since the last save. When the log runs
+// low on space, we copy the live records out of the oldest sector, and erase
+// it. Writes and erases end up spread evenly over the whole chip.
+//
+// Each record carries a sequence number. The last record written by a save
+// carries a commit flag, and at boot, we ignore any records newer than the
+// newest commit, so a save interrupted by a power cut leaves the previous save
+// intact. A record with a bad checksum (half-written) is ignored too.
+//
+// Record layout (little-endian):
+//
+// u32 sequence   - all ones in an unused record
+// u16 block      - block index, plus the commit and live flags
+// u16 checksum   - crc-16 of the rest of the record, minus the live flag
+// u8 payload[save_record_payload]
+//
+// Nothing in this file touches the hardware directly. The store talks to the
+// chip through a Bus, which reads and writes bytes at offsets into the save
+// memory, so the same command sequences run against a simulated flash chip on
+// the desktop and in the host tests, see gba_platform_flashsim.hpp.
+//
+// NOTE: Atmel flash chips program a 128 byte page at a time, and use a
+// different command sequence. We only support the more common byte-programmed
+// chips (Sanyo, Macronix, Panasonic, SST).
+static constexpr u32 save_sector_size = 4096;
+static constexpr u32 save_sector_count = 16;
+static constexpr u32 save_record_size = 128;
+static constexpr u32 save_record_header = 8;
+static constexpr u32 save_record_payload =
+    save_record_size - save_record_header;
+static constexpr u32 save_records_per_sector =
+    save_sector_size / save_record_size;
+static constexpr u32 save_record_count =
+    save_records_per_sector * save_sector_count;
+
+// We keep the live data to a quarter of the chip, so compaction never needs to
+// copy more than a few records to free up a sector.
+static constexpr u32 save_store_blocks = 128;
+static constexpr u32 save_store_capacity =
+    save_store_blocks * save_record_payload;
+
+
+static constexpr u16 save_record_commit = 0x8000;
+static constexpr u16 save_record_live = 0x4000;
+static constexpr u16 save_record_block_mask = 0x0fff;
+static constexpr u16 save_record_none = 0xffff;
+
+
+// How many times we poll the chip for the result of a program or erase command
+// before giving up. Generous, sector erases can take a while.
+static constexpr int flash_timeout = 0x100000;
+
+
+template <typename Bus> class SaveStore {
+public:
+    SaveStore(Bus bus) : bus_(bus)
+    {
+    }
+
+
+    // Scan the log for the newest committed copy of each block. Call once at
+    // boot, before reading or writing.
+    void mount()
+    {
+        for (auto& slot : map_) {
+            slot = save_record_none;
+        }
+
+        u32 sequences[save_store_blocks];
+
+        bool found = false;
+        bool committed = false;
+        u32 newest = 0;
+        u32 newest_slot = 0;
+        u32 newest_commit = 0;
+        u16 used_sectors = 0;
+
+        // Checksumming a record means reading all of it, so remember which
+        // records were valid, rather than checking them again below.
+        u32 valid[save_record_count / 32] = {};
+
+        for (u32 slot = 0; slot < save_record_count; ++slot) {
+            Header h;
+            if (not read_header(slot, h)) {
+                continue;
+            }
+            used_sectors |= 1 << (slot / save_records_per_sector);
+
+            if (not h.valid_) {
+                continue;
+            }
+            valid[slot / 32] |= 1 << (slot % 32);
+
+            if (not found or h.sequence_ > newest) {
+                found = true;
+                newest = h.sequence_;
+                newest_slot = slot;
+            }
+            if ((h.block_ & save_record_commit) and
+                (not committed or h.sequence_ > newest_commit)) {
+                committed = true;
+                newest_commit = h.sequence_;
+            }
+        }
+
+        for (u32 slot = 0; slot < save_record_count; ++slot) {
+            Header h;
+            if (not(valid[slot / 32] & (1 << (slot % 32))) or
+                not read_header(slot, h, false)) {
+                continue;
+            }
+
+            if (not committed or h.sequence_ > newest_commit) {
+                // Left over from an interrupted save. Clear the live flag, so
+                // that the record stays dead after the next commit.
+                discard(slot);
+                continue;
+            }
+
+            const u32 block = h.block_ & save_record_block_mask;
+            if (block >= save_store_blocks) {
+                continue;
+            }
+
+            if (map_[block] == save_record_none or
+                h.sequence_ > sequences[block]) {
+                map_[block] = slot;
+                sequences[block] = h.sequence_;
+            }
+        }
+
+        sequence_ = found ? newest + 1 : 0;
+        head_ = found ? (newest_slot + 1) % save_record_count : 0;
+
+        // The oldest sector is the first sector with anything in it, after the
+        // sector that we're writing to.
+        const u32 head_sector = head_ / save_records_per_sector;
+        tail_ = head_sector;
+        for (u32 i = 1; i < save_sector_count; ++i) {
+            const u32 sector = (head_sector + i) % save_sector_count;
+            if (used_sectors & (1 << sector)) {
+                tail_ = sector;
+                break;
+            }
+        }
+
+        // Whatever we find in a sector that we haven't started writing to yet
+        // belongs to something else, e.g. an older save format.
+        if (head_ % save_records_per_sector == 0 and
+            (used_sectors & (1 << head_sector))) {
+            bool live = false;
+            for (auto slot : map_) {
+                live = live or (slot not_eq save_record_none and
+                                slot / save_records_per_sector == head_sector);
+            }
+            if (not live) {
+                erase_sector(head_sector);
+            }
+        }
+    }
+
+
+    // Blocks that the game never saved read as zeros.
+    void read(u8* data, u32 length)
+    {
+        for (u32 offset = 0; offset < length; ++offset) {
+            const u32 block = offset / save_record_payload;
+            const u32 slot = block < save_store_blocks ? map_[block]
+                                                       : save_record_none;
+            if (slot == save_record_none) {
+                data[offset] = 0;
+            } else {
+                data[offset] = bus_.read(slot * save_record_size +
+                                         save_record_header +
+                                         offset % save_record_payload);
+            }
+        }
+    }
+
+
+    bool write(const u8* data, u32 length)
+    {
+        if (length > save_store_capacity) {
+            return false;
+        }
+
+        // Find the changed blocks first, so that we can make room for all of
+        // them before we start, and so we know which record is the last one.
+        u32 dirty[save_store_blocks / 32] = {};
+        u32 dirty_count = 0;
+        u32 last = 0;
+
+        const u32 blocks =
+            (length + save_record_payload - 1) / save_record_payload;
+
+        for (u32 block = 0; block < blocks; ++block) {
+            u8 payload[save_record_payload];
+            fill_payload(payload, block, data, length);
+
+            if (changed(block, payload)) {
+                dirty[block / 32] |= 1 << (block % 32);
+                ++dirty_count;
+                last = block;
+            }
+        }
+
+        if (dirty_count == 0) {
+            return true;
+        }
+
+        // Keep a sector's worth of space in reserve, so that there's always
+        // room to copy the live records out of the oldest sector.
+        while (free_records() < dirty_count + save_records_per_sector) {
+            if (not compact()) {
+                return false;
+            }
+        }
+
+        u16 written[save_store_blocks];
+        for (u32 block = 0; block < blocks; ++block) {
+            if (not(dirty[block / 32] & (1 << (block % 32)))) {
+                continue;
+            }
+
+            u8 payload[save_record_payload];
+            fill_payload(payload, block, data, length);
+
+            const u16 flags = block == last ? save_record_commit : 0;
+
+            if (not append(block | flags, payload, written[block])) {
+                // The save never committed, so it won't show up after a
+                // reboot. Make sure that it doesn't show up after the next
+                // commit, either.
+                for (u32 b = 0; b < block; ++b) {
+                    if (dirty[b / 32] & (1 << (b % 32))) {
+                        discard(written[b]);
+                    }
+                }
+                return false;
+            }
+        }
+
+        for (u32 block = 0; block < blocks; ++block) {
+            if (dirty[block / 32] & (1 << (block % 32))) {
+                map_[block] = written[block];
+            }
+        }
+
+        return true;
+    }
+
+
+private:
+    struct Header {
+        u32 sequence_;
+        u16 block_;
+        bool valid_;
+    };
+
+
+    // Returns false for an unused record. Without verify, we skip the
+    // checksum, for records that we already know to be valid.
+    bool read_header(u32 slot, Header& header, bool verify = true)
+    {
+        const u32 addr = slot * save_record_size;
+
+        u8 bytes[save_record_header];
+        bool blank = true;
+        for (u32 i = 0; i < save_record_header; ++i) {
+            bytes[i] = bus_.read(addr + i);
+            blank = blank and bytes[i] == 0xff;
+        }
+
+        if (blank) {
+            return false;
+        }
+
+        header.sequence_ = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) |
+                           (u32(bytes[3]) << 24);
+        header.block_ = bytes[4] | (bytes[5] << 8);
+
+        if (not verify) {
+            header.valid_ = true;
+            return true;
+        }
+
+        const u16 checksum = bytes[6] | (bytes[7] << 8);
+
+        Crc16 sum;
+        for (u32 i = 0; i < 6; ++i) {
+            sum.add(i == 5 ? bytes[i] | (save_record_live >> 8) : bytes[i]);
+        }
+        for (u32 i = 0; i < save_record_payload; ++i) {
+            sum.add(bus_.read(addr + save_record_header + i));
+        }
+
+        header.valid_ = sum.get() == checksum and
+                        (header.block_ & save_record_live);
+
+        return true;
+    }
+
+
+    // NOTE: Not a simpler checksum, like fletcher-16, which can't tell 0x00
+    // from 0xff, i.e. can't tell a zero byte from a byte that we never got
+    // around to programming.
+    //
+    // mount() checksums every record on the chip, so we process four bits at a
+    // time, rather than one, with a small table.
+    struct Crc16 {
+        u16 crc_ = 0xffff;
+
+        void add(u8 byte)
+        {
+            static const u16 table[16] = {
+                0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+                0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+            };
+
+            crc_ = (crc_ << 4) ^ table[(crc_ >> 12) ^ (byte >> 4)];
+            crc_ = (crc_ << 4) ^ table[(crc_ >> 12) ^ (byte & 0x0f)];
+        }
+
+        u16 get() const
+        {
+            return crc_;
+        }
+    };
+
+
+    void fill_payload(u8* payload, u32 block, const u8* data, u32 length)
+    {
+        const u32 start = block * save_record_payload;
+        for (u32 i = 0; i < save_record_payload; ++i) {
+            payload[i] = start + i < length ? data[start + i] : 0;
+        }
+    }
+
+
+    bool changed(u32 block, const u8* payload)
+    {
+        const u32 slot = map_[block];
+        if (slot == save_record_none) {
+            for (u32 i = 0; i < save_record_payload; ++i) {
+                if (payload[i]) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        const u32 addr = slot * save_record_size + save_record_header;
+        for (u32 i = 0; i < save_record_payload; ++i) {
+            if (bus_.read(addr + i) not_eq payload[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+
+    u32 free_records() const
+    {
+        const u32 head_sector = head_ / save_records_per_sector;
+        const u32 used_sectors =
+            (head_sector + save_sector_count - tail_) % save_sector_count + 1;
+
+        return (save_records_per_sector - head_ % save_records_per_sector) +
+               (save_sector_count - used_sectors) * save_records_per_sector;
+    }
+
+
+    // Copy the live records out of the oldest sector, and erase it.
+    bool compact()
+    {
+        if (tail_ == head_ / save_records_per_sector) {
+            return false;
+        }
+
+        for (u32 block = 0; block < save_store_blocks; ++block) {
+            const u32 slot = map_[block];
+            if (slot == save_record_none or
+                slot / save_records_per_sector not_eq tail_) {
+                continue;
+            }
+
+            u8 payload[save_record_payload];
+            for (u32 i = 0; i < save_record_payload; ++i) {
+                payload[i] = bus_.read(slot * save_record_size +
+                                       save_record_header + i);
+            }
+
+            // The copy is a complete, committed record in its own right.
+            u16 written;
+            if (not append(block | save_record_commit, payload, written)) {
+                return false;
+            }
+            map_[block] = written;
+        }
+
+        if (not erase_sector(tail_)) {
+            return false;
+        }
+
+        tail_ = (tail_ + 1) % save_sector_count;
+
+        return true;
+    }
+
+
+    // Write a record at the head of the log. If a record fails to program
+    // (e.g. the slot holds garbage from an interrupted save), we leave it
+    // behind and try the next slot.
+    bool append(u16 block, const u8* payload, u16& slot)
+    {
+        u8 header[save_record_header];
+        header[0] = sequence_ & 0xff;
+        header[1] = (sequence_ >> 8) & 0xff;
+        header[2] = (sequence_ >> 16) & 0xff;
+        header[3] = sequence_ >> 24;
+
+        block |= save_record_live;
+        header[4] = block & 0xff;
+        header[5] = block >> 8;
+
+        Crc16 sum;
+        for (u32 i = 0; i < 6; ++i) {
+            sum.add(header[i]);
+        }
+        for (u32 i = 0; i < save_record_payload; ++i) {
+            sum.add(payload[i]);
+        }
+        header[6] = sum.get() & 0xff;
+        header[7] = sum.get() >> 8;
+
+        ++sequence_;
+
+        while (true) {
+            if (free_records() == 0) {
+                return false;
+            }
+
+            slot = head_;
+            head_ = (head_ + 1) % save_record_count;
+
+            if (program_record(slot, header, payload)) {
+                return true;
+            }
+        }
+    }
+
+
+    bool program_record(u32 slot, const u8* header, const u8* payload)
+    {
+        const u32 addr = slot * save_record_size;
+
+        for (u32 i = 0; i < save_record_size; ++i) {
+            if (bus_.read(addr + i) not_eq 0xff) {
+                return false;
+            }
+        }
+
+        // Program the header last, and the checksum last of all, so that a
+        // record interrupted by a power cut never looks complete.
+        for (u32 i = 0; i < save_record_payload; ++i) {
+            if (not program(addr + save_record_header + i, payload[i])) {
+                return false;
+            }
+        }
+
+        for (u32 i = 0; i < save_record_header; ++i) {
+            if (not program(addr + i, header[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+
+    void discard(u32 slot)
+    {
+        const u32 addr = slot * save_record_size + 5;
+        program(addr, bus_.read(addr) & ~(save_record_live >> 8));
+    }
+
+
+    void command(u8 cmd)
+    {
+        bus_.write(0x5555, 0xaa);
+        bus_.write(0x2aaa, 0x55);
+        bus_.write(0x5555, cmd);
+    }
+
+
+    // The chip returns status bits, rather than the data, until it finishes
+    // programming or erasing.
+    bool wait(u32 addr, u8 expected)
+    {
+        for (int i = 0; i < flash_timeout; ++i) {
+            if (bus_.read(addr) == expected) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+
+    bool program(u32 addr, u8 value)
+    {
+        // Erased bytes already read as all ones.
+        if (value == 0xff) {
+            return bus_.read(addr) == 0xff;
+        }
+
+        command(0xa0);
+        bus_.write(addr, value);
+
+        return wait(addr, value);
+    }
+
+
+    bool erase_sector(u32 sector)
+    {
+        const u32 addr = sector * save_sector_size;
+
+        command(0x80);
+        bus_.write(0x5555, 0xaa);
+        bus_.write(0x2aaa, 0x55);
+        bus_.write(addr, 0x30);
+
+        return wait(addr, 0xff);
+    }
+
+
+    Bus bus_;
+
+    // The slot holding the newest copy of each block.
+    u16 map_[save_store_blocks];
+
+    u32 sequence_ = 0;
+
+    // The next record to write, and the oldest sector still holding records.
+    u32 head_ = 0;
+    u32 tail_ = 0;
+};
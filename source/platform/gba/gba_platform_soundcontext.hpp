@@ -1,25 +1,151 @@
 #pragma once
 
 
-#include "memory/buffer.hpp"
+#include "number/numeric.hpp"
 
 
 using AudioSample = s8;
 
 
+// The mixer and the music decoder run as arm code from IWRAM, through the
+// wrappers in gba_arm_routines.cpp. gba_platform.cpp calls some of the same
+// header functions from thumb code, so if the compiler left them out of line,
+// the linker could keep the thumb copy in rom, and the wrappers would call out
+// to it. Code that the wrappers call must therefore always inline into them.
+#define AUDIO_INLINE [[gnu::always_inline]] inline
+
+
+// Volumes are fixed point, where full volume is 1 << audio_volume_shift.
+static constexpr int audio_volume_shift = 6;
+static constexpr u8 audio_full_volume = 1 << audio_volume_shift;
+
+
 struct ActiveSoundInfo {
-    s32 position_;
-    const s32 length_;
-    const AudioSample* data_;
-    s32 priority_;
+    s32 position_ = 0;
+    s32 length_ = 0;
+
+    // Null when the channel is not playing anything.
+    const AudioSample* data_ = nullptr;
+    s32 priority_ = 0;
+
+    // Used by the frame mixer, which resamples sounds as it mixes them.
+    u16 fraction_ = 0;
+
+    u8 volume_ = audio_full_volume;
+
+    // Used by the stereo mixer. Pan ranges from -audio_full_volume (left) to
+    // audio_full_volume (right). A centered sound plays at full volume on both
+    // sides, as in the mono mix, and panning attenuates the opposite side.
+    s8 pan_ = 0;
+    u8 left_volume_ = audio_full_volume;
+    u8 right_volume_ = audio_full_volume;
+
+    void set_volume(u8 volume, s8 pan)
+    {
+        volume_ = volume;
+        pan_ = pan;
+        left_volume_ = pan > 0 ? (volume * (audio_full_volume - pan)) >>
+                                     audio_volume_shift
+                               : volume;
+        right_volume_ = pan < 0 ? (volume * (audio_full_volume + pan)) >>
+                                      audio_volume_shift
+                                : volume;
+    }
+
+    // Incremented whenever we start a new sound on the channel, so that sound
+    // handles referring to an old sound stop working.
+    u16 generation_ = 0;
 };
 
 
 struct SoundContext {
     // Only three sounds will play at a time... hey, sound mixing's expensive!
-    Buffer<ActiveSoundInfo, 3> active_sounds;
+    // Channels keep their index for the duration of a sound, so a sound handle
+    // can refer to a channel directly.
+    static constexpr int channel_count = 3;
+    ActiveSoundInfo channels[channel_count];
 
     const AudioSample* music_track = nullptr;
     s32 music_track_length = 0;
     s32 music_track_pos = 0;
+    u16 music_track_fraction = 0;
+    u8 music_volume = audio_full_volume;
+
+    // During a crossfade, the previous music track keeps playing, and fades
+    // out as the current track fades in. fade_level holds the current track's
+    // volume, in 16.16 fixed point. The mixer clears fade_track when the fade
+    // finishes.
+    const AudioSample* fade_track = nullptr;
+    s32 fade_track_length = 0;
+    s32 fade_track_pos = 0;
+    u16 fade_track_fraction = 0;
+    u32 fade_level = 0;
+    u32 fade_step = 0;
+
+
+    // A sound handle packs the channel index into the low bits, and the
+    // channel's generation counter into the rest, so we can find a sound's
+    // channel, and check whether the handle is stale, without searching. Zero
+    // is never a valid handle.
+    static constexpr int handle_channel_bits = 2;
+
+
+    // Pick a channel for a new sound: an idle channel, or else the lowest
+    // priority channel, if its priority is lower than the new sound's. Returns
+    // -1 if every channel is busy with a sound of equal or higher priority.
+    // Shared by all of the platforms, so that sounds evict each other the same
+    // way everywhere.
+    int pick_channel(int priority) const
+    {
+        int target = -1;
+        for (int i = 0; i < channel_count; ++i) {
+            const auto& ch = channels[i];
+            if (ch.data_ == nullptr) {
+                return i;
+            }
+            if (ch.priority_ < priority and
+                (target == -1 or ch.priority_ < channels[target].priority_)) {
+                target = i;
+            }
+        }
+        return target;
+    }
+
+
+    // Start a sound on a channel picked by pick_channel(), and return a handle
+    // to the new sound.
+    u32 start(int channel, const AudioSample* data, s32 length, int priority)
+    {
+        auto& ch = channels[channel];
+        ch.position_ = 0;
+        ch.length_ = length;
+        ch.data_ = data;
+        ch.priority_ = priority;
+        ch.fraction_ = 0;
+        ch.set_volume(audio_full_volume, 0);
+
+        if (++ch.generation_ == 0) {
+            ch.generation_ = 1;
+        }
+
+        return (ch.generation_ << handle_channel_bits) | channel;
+    }
+
+
+    // Returns null if the handle's sound is no longer playing.
+    ActiveSoundInfo* find(u32 handle)
+    {
+        const auto index = handle & ((1 << handle_channel_bits) - 1);
+        if (index >= channel_count) {
+            return nullptr;
+        }
+
+        auto& ch = channels[index];
+        if (ch.data_ == nullptr or
+            ch.generation_ not_eq (handle >> handle_channel_bits)) {
+            return nullptr;
+        }
+
+        return &ch;
+    }
 };
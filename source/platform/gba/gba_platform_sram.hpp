@@ -0,0 +1,35 @@
+#pragma once
+
+
+#include "number/int.h"
+
+
+// Cartridge ram has an eight-bit bus, so we have to copy one byte at a time.
+// Either pointer may point into sram. Nothing here touches the hardware
+// directly, so the copy loop can be compiled and benchmarked on any platform,
+// see gba_arm_routines.cpp for the IWRAM version that the engine calls.
+inline void sram_copy_bytes(u8* dest, const u8* src, u32 length)
+{
+    // NOTE: volatile, so that the compiler doesn't merge the byte accesses into
+    // word accesses, or replace the loop with a call to memcpy.
+    auto d = (volatile u8*)dest;
+    auto s = (const volatile u8*)src;
+
+    while (length >= 8) {
+        d[0] = s[0];
+        d[1] = s[1];
+        d[2] = s[2];
+        d[3] = s[3];
+        d[4] = s[4];
+        d[5] = s[5];
+        d[6] = s[6];
+        d[7] = s[7];
+        d += 8;
+        s += 8;
+        length -= 8;
+    }
+
+    while (length--) {
+        *(d++) = *(s++);
+    }
+}
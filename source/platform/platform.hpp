@@ -162,6 +162,16 @@ public:
 
     void scroll(Layer layer, u16 xscroll, u16 yscroll);
 
+    // Cycle the graphics of tile index `tile` in a map layer through the tiles
+    // start, start + 1, ... start + length - 1 of the layer's texture,
+    // advancing one frame every `rate` display() calls. Every instance of the
+    // tile animates, without any further set_tile() calls. Pass a length of
+    // zero to stop animating a tile, which restores its original graphics.
+    // Loading a new texture into the layer stops the layer's animations.
+    // Returns false if the platform has no room for more animated tiles, or
+    // does not support animated tiles.
+    bool animate_tile(Layer layer, u16 tile, u16 start, u8 length, u8 rate);
+
 
     void fill_overlay(u16 TileDesc);
 
@@ -241,6 +251,9 @@ public:
 
     int scratch_buffers_remaining();
 
+    // The most scratch buffers in use at once, since startup.
+    int scratch_buffer_highwater();
+
 
     ////////////////////////////////////////////////////////////////////////////
     // DeltaClock
@@ -342,6 +355,29 @@ public:
                       bool include_background = true,
                       bool include_sprites = true);
 
+        struct SpriteCacheStats {
+            // Frames copied into vram during the most recent display() call.
+            u32 uploads_ = 0;
+
+            // Totals since the spritesheet was loaded.
+            u32 hits_ = 0;
+            u32 misses_ = 0;
+        };
+
+        // When sprite streaming is enabled, the platform uploads spritesheet
+        // frames to vram on demand. Zeroes if the platform does not stream
+        // sprites.
+        SpriteCacheStats sprite_cache_stats() const;
+
+        // Returns a reason if the platform cannot currently draw sprites of
+        // the given size. With sprite streaming enabled, the gba only draws
+        // 16x16 sprites.
+        std::optional<FailureReason> check_sprite_size(Sprite::Size size) const;
+
+        // Bytes of overlay tile map copied to vram by the most recent call to
+        // display(). Zero if the platform does not track this.
+        u32 overlay_copy_bytes() const;
+
     private:
         Screen();
 
@@ -498,6 +534,22 @@ public:
         void play_music(const char* name, Microseconds offset);
         void stop_music();
 
+        struct MusicOptions {
+            // Crossfade from the current track, rather than cutting over.
+            Microseconds fade_ = 0;
+
+            // The sample where the track starts over, once it reaches its end.
+            u32 loop_start_ = 0;
+
+            // Start playing once the current track reaches its end, instead
+            // of right away.
+            bool queue_ = false;
+        };
+
+        void play_music(const char* name,
+                        Microseconds offset,
+                        const MusicOptions& options);
+
         // A platform's speaker may only have the resources to handle a limited
         // number of overlapping sounds. For such platforms, currently running
         // sounds with a lower priority will be evicted, to make room for
@@ -506,11 +558,28 @@ public:
         // If you pass in an optional position, platforms that support spatial
         // audio will attenuate the sound based on distance to the listener (the
         // camera center);
-        void play_sound(const char* name,
-                        int priority,
-                        std::optional<Vec2<Float>> position = {});
+        //
+        // Returns a handle to the playing sound, or null_sound if the sound
+        // could not be played. Handles stop working once their sound finishes,
+        // or gets evicted, and the functions below ignore stale handles.
+        using SoundHandle = u32;
+        static constexpr SoundHandle null_sound = 0;
+
+        SoundHandle play_sound(const char* name,
+                               int priority,
+                               std::optional<Vec2<Float>> position = {});
         bool is_sound_playing(const char* name);
 
+        bool is_playing(SoundHandle sound);
+        void stop_sound(SoundHandle sound);
+
+        // A volume of one plays the sound at its original volume.
+        void set_volume(SoundHandle sound, Float volume);
+
+        // Pan ranges from -1 (left) to 1 (right). Only audible with the
+        // stereo_audio feature enabled.
+        void set_pan(SoundHandle sound, Float pan);
+
         // Updates the listener position for spatialized audio, if supported.
         void set_position(const Vec2<Float>& position);
 
@@ -781,3 +850,14 @@ inline void error(Platform&, const char*)
 
 
 u16 arctangent(u16 y, u16 x);
+
+
+// Copy to or from cartridge sram, which only supports byte-sized accesses.
+// Either pointer may point into sram.
+void sram_copy(void* dest, const void* src, u32 length);
+
+
+// Decompress a file that build.lua compressed into dest, which must have room
+// for the decompressed data. Returns the decompressed size, or zero if the
+// file is not compressed. Pass a null dest to find out the size.
+u32 decompress(const Filesystem::FileData& file, void* dest);
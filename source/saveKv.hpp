@@ -0,0 +1,452 @@
+#pragma once
+
+
+#include "number/int.h"
+#include <cstring>
+
+extern "C" {
+#include "lua/lauxlib.h"
+}
+
+
+// The encoding of the values that scripts persist with save_put(), see
+// BPCoreEngine.cpp for where the engine keeps the store. Values start with a
+// tag:
+//
+// 0x00        - end of table
+// 0x01, 0x02  - false, true
+// 0x03        - integer, zigzag varint
+// 0x04        - float, four bytes
+// 0x05        - string, varint length, then the bytes
+// 0x06        - table, key/value pairs, then an end of table tag
+// 0x20 - 0x3f - string of up to 31 bytes, length in the low bits
+// 0x80 - 0xff - integer from 0 to 127
+static const int save_kv_max_depth = 16;
+
+
+enum SaveTag : u8 {
+    save_tag_end,
+    save_tag_false,
+    save_tag_true,
+    save_tag_int,
+    save_tag_float,
+    save_tag_string,
+    save_tag_table,
+    save_tag_short_string = 0x20,
+    save_tag_small_int = 0x80,
+};
+
+
+// Fletcher-16, over the store's entries.
+inline u16 save_kv_checksum(const u8* data, int length)
+{
+    u16 a = 0;
+    u16 b = 0;
+    for (int i = 0; i < length; ++i) {
+        a = (a + data[i]) % 255;
+        b = (b + a) % 255;
+    }
+    return (b << 8) | a;
+}
+
+
+// Writes into the store's free space. With a null destination, only counts the
+// bytes, so that we can check whether a value fits before touching the store.
+struct SaveWriter {
+    u8* out_;
+    int size_ = 0;
+
+
+    void put(u8 byte)
+    {
+        if (out_) {
+            out_[size_] = byte;
+        }
+        ++size_;
+    }
+
+
+    void put_varint(u32 value)
+    {
+        while (value >= 0x80) {
+            put(value | 0x80);
+            value >>= 7;
+        }
+        put(value);
+    }
+
+
+    void put_string(const char* str, size_t len)
+    {
+        if (len < 32) {
+            put(save_tag_short_string | len);
+        } else {
+            put(save_tag_string);
+            put_varint(len);
+        }
+        for (size_t i = 0; i < len; ++i) {
+            put(str[i]);
+        }
+    }
+
+
+    // Encodes the value at the given stack index.
+    void put_value(lua_State* L, int index, int depth)
+    {
+        switch (lua_type(L, index)) {
+        case LUA_TBOOLEAN:
+            put(lua_toboolean(L, index) ? save_tag_true : save_tag_false);
+            break;
+
+        case LUA_TNUMBER:
+            if (lua_isinteger(L, index)) {
+                const auto value = lua_tointeger(L, index);
+                if (value >= 0 and value < 128) {
+                    put(save_tag_small_int | value);
+                } else {
+                    put(save_tag_int);
+                    const u32 bits = value;
+                    put_varint((bits << 1) ^ -(bits >> 31));
+                }
+            } else {
+                const float value = lua_tonumber(L, index);
+                u32 bits;
+                memcpy(&bits, &value, sizeof bits);
+                put(save_tag_float);
+                for (int i = 0; i < 4; ++i) {
+                    put(bits >> (i * 8));
+                }
+            }
+            break;
+
+        case LUA_TSTRING: {
+            size_t len;
+            const char* str = lua_tolstring(L, index, &len);
+            put_string(str, len);
+            break;
+        }
+
+        case LUA_TTABLE:
+            if (depth == save_kv_max_depth) {
+                luaL_error(L, "save_put: tables nested too deeply");
+            }
+            luaL_checkstack(L, 3, "save_put");
+            index = lua_absindex(L, index);
+            put(save_tag_table);
+            lua_pushnil(L);
+            while (lua_next(L, index)) {
+                put_value(L, -2, depth + 1);
+                put_value(L, -1, depth + 1);
+                lua_pop(L, 1);
+            }
+            put(save_tag_end);
+            break;
+
+        default:
+            luaL_error(
+                L, "save_put: cannot save a %s", luaL_typename(L, index));
+        }
+    }
+};
+
+
+struct SaveReader {
+    const u8* pos_;
+    const u8* end_;
+
+
+    bool get(u8& byte)
+    {
+        if (pos_ == end_) {
+            return false;
+        }
+        byte = *(pos_++);
+        return true;
+    }
+
+
+    bool get_varint(u32& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            u8 byte;
+            if (not get(byte)) {
+                return false;
+            }
+            value |= u32(byte & 0x7f) << shift;
+            if (not(byte & 0x80)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+
+    // The length of a string, given its tag.
+    bool get_string_length(u8 tag, u32& len)
+    {
+        if ((tag & 0xe0) == save_tag_short_string) {
+            len = tag & 0x1f;
+        } else if (not get_varint(len)) {
+            return false;
+        }
+        return len <= u32(end_ - pos_);
+    }
+
+
+    // Decode a value, and push it onto the lua stack. With a null lua state,
+    // skips over the value instead.
+    bool get_value(lua_State* L, int depth)
+    {
+        u8 tag = 0;
+        if (not get(tag)) {
+            return false;
+        }
+
+        if (tag & save_tag_small_int) {
+            if (L) {
+                lua_pushinteger(L, tag & 0x7f);
+            }
+            return true;
+        }
+
+        if ((tag & 0xe0) == save_tag_short_string) {
+            tag = save_tag_string;
+        }
+
+        switch (tag) {
+        case save_tag_false:
+        case save_tag_true:
+            if (L) {
+                lua_pushboolean(L, tag == save_tag_true);
+            }
+            return true;
+
+        case save_tag_int: {
+            u32 bits;
+            if (not get_varint(bits)) {
+                return false;
+            }
+            if (L) {
+                lua_pushinteger(L, lua_Integer((bits >> 1) ^ -(bits & 1)));
+            }
+            return true;
+        }
+
+        case save_tag_float: {
+            u32 bits = 0;
+            for (int i = 0; i < 4; ++i) {
+                u8 byte;
+                if (not get(byte)) {
+                    return false;
+                }
+                bits |= u32(byte) << (i * 8);
+            }
+            if (L) {
+                float value;
+                memcpy(&value, &bits, sizeof value);
+                lua_pushnumber(L, value);
+            }
+            return true;
+        }
+
+        case save_tag_string: {
+            u32 len;
+            if (not get_string_length(pos_[-1], len)) {
+                return false;
+            }
+            if (L) {
+                lua_pushlstring(L, (const char*)pos_, len);
+            }
+            pos_ += len;
+            return true;
+        }
+
+        case save_tag_table: {
+            // If the data ends partway through the table, we drop the table,
+            // along with any key that we pushed, so that a failed read leaves
+            // the stack as it was.
+            const int top = L ? lua_gettop(L) : 0;
+            if (depth == save_kv_max_depth) {
+                return false;
+            }
+            if (L) {
+                luaL_checkstack(L, 3, "save_get");
+                lua_newtable(L);
+            }
+            while (true) {
+                if (pos_ == end_) {
+                    break;
+                }
+                if (*pos_ == save_tag_end) {
+                    ++pos_;
+                    return true;
+                }
+                if (not get_value(L, depth + 1) or
+                    not get_value(L, depth + 1)) {
+                    break;
+                }
+                if (L) {
+                    lua_rawset(L, -3);
+                }
+            }
+            if (L) {
+                lua_settop(L, top);
+            }
+            return false;
+        }
+
+        default:
+            return false;
+        }
+    }
+};
+
+
+// The store starts with a header (little-endian):
+//
+// char magic[4] - "BPKV"
+// u16 length    - of the entries
+// u16 checksum  - fletcher-16 of the entries
+//
+// followed by the entries themselves.
+static const int save_kv_header = 8;
+
+
+inline void save_kv_seal(u8* store, int length)
+{
+    const u16 checksum = save_kv_checksum(store + save_kv_header, length);
+
+    store[0] = 'B';
+    store[1] = 'P';
+    store[2] = 'K';
+    store[3] = 'V';
+    store[4] = length & 0xff;
+    store[5] = length >> 8;
+    store[6] = checksum & 0xff;
+    store[7] = checksum >> 8;
+}
+
+
+// Returns the length of the entries, or -1, if the header is missing, or does
+// not match the entries that follow it.
+inline int save_kv_verify(const u8* store, int size)
+{
+    if (size < save_kv_header) {
+        return -1;
+    }
+
+    const int length = store[4] | (store[5] << 8);
+    const u16 checksum = store[6] | (store[7] << 8);
+
+    if (store[0] == 'B' and store[1] == 'P' and store[2] == 'K' and
+        store[3] == 'V' and length <= size - save_kv_header and
+        save_kv_checksum(store + save_kv_header, length) == checksum) {
+        return length;
+    }
+
+    return -1;
+}
+
+
+// The entries after the header: a string key, followed by its value, for each
+// key in the store.
+struct SaveEntries {
+    u8* data_;
+    int capacity_;
+    int length_ = 0;
+
+
+    // Find a key's entry. Returns false if the key isn't there.
+    bool find(const char* key, size_t key_len, u8*& start, u8*& end) const
+    {
+        SaveReader reader{data_, data_ + length_};
+
+        while (reader.pos_ not_eq reader.end_) {
+            start = const_cast<u8*>(reader.pos_);
+
+            u8 tag;
+            u32 len;
+            if (not reader.get(tag) or not reader.get_string_length(tag, len)) {
+                return false;
+            }
+
+            const bool match =
+                len == key_len and memcmp(reader.pos_, key, key_len) == 0;
+            reader.pos_ += len;
+
+            if (not reader.get_value(nullptr, 0)) {
+                return false;
+            }
+
+            if (match) {
+                end = const_cast<u8*>(reader.pos_);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    // Replaces a key's value with the value at the given stack index, or
+    // removes the key, if the value is nil. Raises a lua error, and leaves the
+    // entries as they were, if the value cannot be saved, or does not fit.
+    void put(lua_State* L, const char* key, size_t key_len, int index)
+    {
+        u8* start = nullptr;
+        u8* end = nullptr;
+        int old_size = 0;
+        if (find(key, key_len, start, end)) {
+            old_size = end - start;
+        }
+
+        SaveWriter writer{nullptr};
+        if (not lua_isnil(L, index)) {
+            writer.put_string(key, key_len);
+            writer.put_value(L, index, 0);
+        }
+
+        if (length_ - old_size + writer.size_ > capacity_) {
+            luaL_error(L, "save_put: save data full");
+        }
+
+        if (old_size) {
+            memmove(start, end, (data_ + length_) - end);
+            length_ -= old_size;
+        }
+
+        if (writer.size_) {
+            writer.out_ = data_ + length_;
+            writer.size_ = 0;
+            writer.put_string(key, key_len);
+            writer.put_value(L, index, 0);
+            length_ += writer.size_;
+        }
+    }
+
+
+    // Pushes a key's value, or nil, if the key isn't there.
+    void get(lua_State* L, const char* key, size_t key_len) const
+    {
+        u8* start;
+        u8* end;
+        if (not find(key, key_len, start, end)) {
+            lua_pushnil(L);
+            return;
+        }
+
+        SaveReader reader{start, end};
+
+        // Skip the key, find() has already read it.
+        u8 tag = 0;
+        u32 len = 0;
+        reader.get(tag);
+        reader.get_string_length(tag, len);
+        reader.pos_ += len;
+
+        if (not reader.get_value(L, 0)) {
+            luaL_error(L, "save_get: corrupt save data");
+        }
+    }
+};
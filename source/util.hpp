@@ -19,6 +19,15 @@
 #endif
 
 
+// For large buffers that do not need to live in fast memory. On the gba, places
+// the data in external work ram, rather than in the tiny 32kb internal ram.
+#ifdef __GBA__
+#define SLOW_RAM_DATA __attribute__((section(".ewram")))
+#else
+#define SLOW_RAM_DATA
+#endif
+
+
 namespace _detail {
 
 template <typename T> struct reversion_wrapper {
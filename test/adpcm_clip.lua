@@ -0,0 +1,64 @@
+#!/usr/bin/env lua
+---
+--- Writes a reference clip as raw 8-bit pcm, along with build.lua's adpcm
+--- encoding of it, for adpcm_test.cpp to decode and compare against:
+---
+--- lua adpcm_clip.lua path/to/build.lua clip.raw clip.ima
+---
+
+
+bpcore_build_functions_only = true
+dofile(arg[1])
+
+
+local samples = {}
+
+local function add(count, fn)
+   for i = 0, count - 1 do
+      local s = math.floor(fn(i) + 0.5)
+      samples[#samples + 1] = math.min(math.max(s, -128), 127)
+   end
+end
+
+
+-- Pseudo-random, so that the clip comes out the same everywhere.
+local seed = 1
+local function noise()
+   seed = (seed * 1103515245 + 12345) % 2147483648
+   return seed // 65536 % 256 - 128
+end
+
+
+local function tone(i, hz)
+   return math.sin(i * 2 * math.pi * hz / 16000)
+end
+
+
+-- Something like music: a tone that fades in from silence, a chord, quiet
+-- noise, a sweep, and a decaying tone. Each section changes abruptly right at
+-- a block boundary, where the decoder reloads its predictor from the block
+-- header, and the clip ends partway through a block.
+add(512, function(i) return 100 * tone(i, 440) * math.min(i / 64, 1) end)
+add(512, function(i)
+   return 40 * (tone(i, 262) + tone(i, 330) + tone(i, 392))
+end)
+add(512, function(i) return noise() / 16 end)
+add(512, function(i) return 90 * math.sin(i * i * math.pi / 200000) end)
+add(300, function(i) return 60 * tone(i, 320) * (1 - i / 300) end)
+
+
+local pcm = {}
+for i, s in ipairs(samples) do
+   pcm[i] = string.char(s % 256)
+end
+pcm = table.concat(pcm)
+
+
+local function write(path, data)
+   local file = assert(io.open(path, "wb"))
+   file:write(data)
+   file:close()
+end
+
+write(arg[2], pcm)
+write(arg[3], encode_adpcm(pcm))
@@ -0,0 +1,112 @@
+#include "platform/gba/gba_platform_adpcm.hpp"
+#include "test.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+
+// Decodes a clip that adpcm_clip.lua encoded with build.lua, and compares it
+// with the original pcm. The encoder runs its own copy of the decoder, so if
+// the two ever disagree about the decoder state, the error grows without
+// bound, rather than staying within the quantization noise.
+//
+// adpcm_test clip.raw clip.ima
+
+
+static std::vector<u8> read_file(const char* path)
+{
+    std::vector<u8> result;
+
+    if (auto f = fopen(path, "rb")) {
+        int c;
+        while ((c = fgetc(f)) not_eq EOF) {
+            result.push_back(c);
+        }
+        fclose(f);
+    }
+
+    return result;
+}
+
+
+static std::vector<AudioSample>
+decode(AdpcmStream& stream, int count, int chunk)
+{
+    std::vector<AudioSample> result(count);
+    for (int i = 0; i < count; i += chunk) {
+        adpcm_decode(stream, result.data() + i, std::min(chunk, count - i));
+    }
+    return result;
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc not_eq 3) {
+        fprintf(stderr, "usage: adpcm_test clip.raw clip.ima\n");
+        return 1;
+    }
+
+    const auto pcm = read_file(argv[1]);
+    const auto ima = read_file(argv[2]);
+    CHECK(pcm.size() > 3 * adpcm_block_samples);
+
+    const int count = pcm.size();
+    const int blocks = (count + adpcm_block_samples - 1) / adpcm_block_samples;
+    CHECK(int(ima.size()) ==
+          adpcm_file_header_bytes + blocks * adpcm_block_bytes);
+
+    AdpcmStream stream;
+    CHECK(adpcm_open(stream, ima.data(), ima.size()));
+    CHECK(stream.sample_count_ == u32(count));
+
+    // A truncated file, or one with the wrong magic, does not open.
+    AdpcmStream rejected;
+    CHECK(not adpcm_open(rejected, ima.data(), ima.size() - 1));
+    CHECK(not adpcm_open(rejected, pcm.data(), pcm.size()));
+
+    const auto decoded = decode(stream, count, count);
+
+    double error_sum = 0;
+    int max_error = 0;
+    for (int i = 0; i < count; ++i) {
+        const int error = std::abs(decoded[i] - AudioSample(pcm[i]));
+        error_sum += error * error;
+        max_error = std::max(max_error, error);
+    }
+
+    const double rms = std::sqrt(error_sum / count);
+    printf("adpcm: rms error %.2f, max error %d\n", rms, max_error);
+
+    // IMA-ADPCM can only change the step size so fast, so the error peaks
+    // where the signal changes abruptly, e.g. at the start of the clip's
+    // last block, but it should stay within a few steps of the 8-bit output.
+    CHECK(rms < 1.5);
+    CHECK(max_error <= 12);
+
+    // Decoding in small pieces, that start and stop on either side of the
+    // block boundaries, produces the same samples.
+    for (int chunk : {1, 7, 64, 511, 513}) {
+        adpcm_seek(stream, 0);
+        CHECK(decode(stream, count, chunk) == decoded);
+    }
+
+    // Music loops, so the decoder wraps around at the end of the clip.
+    adpcm_seek(stream, 0);
+    const auto looped = decode(stream, count * 2 + 100, 300);
+    for (int i = 0; i < count * 2 + 100; ++i) {
+        CHECK(looped[i] == decoded[i % count]);
+    }
+
+    // Seeking lands on the same samples, whether or not the target lies on a
+    // block boundary.
+    for (int target : {0, 1, 511, 512, 1000, 1536, count - 1, count + 10}) {
+        adpcm_seek(stream, target);
+        const auto after = decode(stream, 64, 64);
+        for (int i = 0; i < 64; ++i) {
+            CHECK(after[i] == decoded[(target + i) % count]);
+        }
+    }
+
+    return test_result("adpcm_test");
+}
@@ -0,0 +1,270 @@
+#include "platform/gba/gba_platform_mixer.hpp"
+#include "test.hpp"
+
+
+// One input sample per output sample, so the tests can predict exactly which
+// samples the mixer reads.
+static constexpr u32 unit_step = 1 << 16;
+
+
+static AudioSample silence[4] = {};
+
+
+static void reset(SoundContext& ctx)
+{
+    ctx = SoundContext{};
+    ctx.music_track = silence;
+    ctx.music_track_length = 4;
+}
+
+
+static void test_clamp_and_pack()
+{
+    const s32 full = audio_full_volume;
+
+    s32 acc[4] = {5 * full, 1000 * full, -1000 * full, -128 * full};
+
+    alignas(4) AudioSample out[4];
+    pack_samples(acc, out);
+
+    CHECK(out[0] == 5);
+    CHECK(out[1] == 127);
+    CHECK(out[2] == -128);
+    CHECK(out[3] == -128);
+}
+
+
+static void test_mono_mix()
+{
+    SoundContext ctx;
+    reset(ctx);
+
+    AudioSample music[8];
+    for (auto& s : music) {
+        s = 10;
+    }
+    ctx.music_track = music;
+    ctx.music_track_length = 8;
+
+    AudioSample sound[8] = {20, -20, 100, 120, -100, -120, 0, 0};
+    ctx.start(0, sound, 8, 0);
+    ctx.channels[0].set_volume(audio_full_volume / 2, 0);
+
+    alignas(4) AudioSample out[8];
+    mix_audio_frame(ctx, out, 8, unit_step);
+
+    // music + sound / 2, clamped.
+    CHECK(out[0] == 20);
+    CHECK(out[1] == 0);
+    CHECK(out[2] == 60);
+    CHECK(out[3] == 70);
+    CHECK(out[4] == -40);
+    CHECK(out[5] == -50);
+    CHECK(out[6] == 10);
+
+    // Louder sounds clip, rather than wrapping around.
+    ctx.music_track_pos = 0;
+    ctx.start(1, sound, 8, 0);
+    ctx.start(2, sound, 8, 0);
+    mix_audio_frame(ctx, out, 8, unit_step);
+    CHECK(out[2] == 127);
+    CHECK(out[4] == -128);
+}
+
+
+static void test_stereo_pan()
+{
+    SoundContext ctx;
+    reset(ctx);
+
+    AudioSample music[4] = {4, 4, 4, 4};
+    ctx.music_track = music;
+
+    AudioSample sound[4] = {64, 64, 64, 64};
+
+    ctx.start(0, sound, 4, 0);
+    ctx.channels[0].set_volume(audio_full_volume, -audio_full_volume);
+    CHECK(ctx.channels[0].left_volume_ == audio_full_volume);
+    CHECK(ctx.channels[0].right_volume_ == 0);
+
+    alignas(4) AudioSample left[4];
+    alignas(4) AudioSample right[4];
+    mix_audio_frame_stereo(ctx, left, right, 4, unit_step);
+
+    // Music plays centered.
+    CHECK(left[0] == 68);
+    CHECK(right[0] == 4);
+
+    // Half right: full volume on the right, half on the left.
+    ctx.start(0, sound, 4, 0);
+    ctx.channels[0].set_volume(audio_full_volume, audio_full_volume / 2);
+    mix_audio_frame_stereo(ctx, left, right, 4, unit_step);
+    CHECK(left[0] == 36);
+    CHECK(right[0] == 68);
+
+    // Volume and pan combine.
+    ctx.channels[0].set_volume(audio_full_volume / 2, audio_full_volume / 2);
+    CHECK(ctx.channels[0].left_volume_ == audio_full_volume / 4);
+    CHECK(ctx.channels[0].right_volume_ == audio_full_volume / 2);
+
+    // Centered sounds sound the same as in the mono mix.
+    alignas(4) AudioSample mono[4];
+    ctx.start(0, sound, 4, 0);
+    ctx.channels[0].set_volume(audio_full_volume / 2, 0);
+    mix_audio_frame(ctx, mono, 4, unit_step);
+    ctx.start(0, sound, 4, 0);
+    ctx.channels[0].set_volume(audio_full_volume / 2, 0);
+    mix_audio_frame_stereo(ctx, left, right, 4, unit_step);
+    CHECK(mono[0] == left[0] and mono[0] == right[0]);
+}
+
+
+// Sounds stop when they run out of samples, even partway through a group of
+// four, and the music loops.
+static void test_sound_ends()
+{
+    SoundContext ctx;
+    reset(ctx);
+
+    AudioSample music[3] = {1, 2, 3};
+    ctx.music_track = music;
+    ctx.music_track_length = 3;
+
+    AudioSample sound[6] = {10, 10, 10, 10, 10, 10};
+    const auto handle = ctx.start(0, sound, 6, 0);
+
+    alignas(4) AudioSample out[8];
+    mix_audio_frame(ctx, out, 8, unit_step);
+
+    const AudioSample expected[8] = {11, 12, 13, 11, 12, 13, 1, 2};
+    for (int i = 0; i < 8; ++i) {
+        CHECK(out[i] == expected[i]);
+    }
+
+    CHECK(ctx.channels[0].data_ == nullptr);
+    CHECK(ctx.find(handle) == nullptr);
+    CHECK(ctx.music_track_pos == 2);
+}
+
+
+// The frame mixer resamples our 16kHz sounds to the hardware's sample rate.
+static void test_resample()
+{
+    SoundContext ctx;
+    reset(ctx);
+
+    static AudioSample sound[mixer_frame_samples] = {};
+    ctx.start(0, sound, mixer_frame_samples, 0);
+
+    alignas(4) AudioSample out[mixer_frame_samples];
+    mix_audio_frame(ctx, out, mixer_frame_samples, mixer_resample_step);
+
+    const u64 consumed = u64(mixer_resample_step) * mixer_frame_samples;
+    CHECK(ctx.channels[0].position_ == s32(consumed >> 16));
+    CHECK(ctx.channels[0].fraction_ == (consumed & 0xffff));
+
+    // A frame plays 16000 / 59.73 samples of a 16kHz sound.
+    CHECK(ctx.channels[0].position_ == 267);
+}
+
+
+static void test_crossfade()
+{
+    SoundContext ctx;
+    reset(ctx);
+
+    AudioSample current[4] = {64, 64, 64, 64};
+    AudioSample previous[4] = {-64, -64, -64, -64};
+
+    ctx.music_track = current;
+    ctx.fade_track = previous;
+    ctx.fade_track_length = 4;
+    ctx.fade_level = 0;
+    ctx.fade_step = (audio_full_volume << 16) / 2;
+
+    alignas(4) AudioSample out[12];
+    mix_audio_frame(ctx, out, 12, unit_step);
+
+    CHECK(out[0] == -64);
+    CHECK(out[4] == 0);
+    CHECK(ctx.fade_track == nullptr);
+    CHECK(out[8] == 64);
+
+    // The frame mixer plays more samples per second than the 16kHz tracks
+    // hold, so a crossfade needs more steps to last as long. A 100ms fade
+    // should end after about 1600 samples of the track.
+    static AudioSample track[4000] = {};
+    reset(ctx);
+    ctx.music_track = track;
+    ctx.music_track_length = 4000;
+    ctx.fade_track = track;
+    ctx.fade_track_length = 4000;
+
+    const u32 fade_samples = mixer_samples(100000);
+    CHECK(fade_samples == 1815);
+    ctx.fade_level = 0;
+    ctx.fade_step = (audio_full_volume << 16) / (fade_samples / 4);
+
+    u32 played = 0;
+    while (ctx.fade_track and played < 4000) {
+        mix_audio_frame(ctx, out, 4, mixer_resample_step);
+        played += 4;
+    }
+
+    CHECK(played >= fade_samples and played <= fade_samples + 4);
+    CHECK(ctx.music_track_pos >= 1600 and ctx.music_track_pos <= 1604);
+}
+
+
+static void test_handles()
+{
+    SoundContext ctx;
+    reset(ctx);
+
+    AudioSample sound[4] = {};
+
+    CHECK(ctx.pick_channel(0) == 0);
+    const auto first = ctx.start(0, sound, 4, 5);
+    CHECK(first not_eq 0);
+    CHECK(ctx.find(first) == &ctx.channels[0]);
+
+    CHECK(ctx.pick_channel(0) == 1);
+    ctx.start(1, sound, 4, 3);
+    ctx.start(2, sound, 4, 7);
+
+    // Every channel is busy: evict the lowest priority sound, but only for a
+    // sound with a higher priority.
+    CHECK(ctx.pick_channel(3) == -1);
+    CHECK(ctx.pick_channel(4) == 1);
+
+    // Re-using a channel invalidates handles to the old sound.
+    const auto second = ctx.start(0, sound, 4, 5);
+    CHECK(second not_eq first);
+    CHECK(ctx.find(first) == nullptr);
+    CHECK(ctx.find(second) == &ctx.channels[0]);
+
+    // Handles never refer to the fourth channel index.
+    CHECK(ctx.find(second | 3) == nullptr);
+
+    // The generation counter wraps around, but skips zero, so that we never
+    // hand out a zero handle.
+    ctx.channels[2].generation_ = 0xffff;
+    const auto wrapped = ctx.start(2, sound, 4, 0);
+    CHECK(ctx.channels[2].generation_ == 1);
+    CHECK(wrapped not_eq 0);
+    CHECK(ctx.find(wrapped) == &ctx.channels[2]);
+}
+
+
+int main()
+{
+    test_clamp_and_pack();
+    test_mono_mix();
+    test_stereo_pan();
+    test_sound_ends();
+    test_resample();
+    test_crossfade();
+    test_handles();
+
+    return test_result("audio_mixer_test");
+}
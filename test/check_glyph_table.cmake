@@ -0,0 +1,23 @@
+# Regenerates the glyph table from build/charset_mapping.txt, and checks that
+# the result matches the checked-in copy in source/data/glyph_table.cpp.
+#
+# cmake -DPYTHON=... -DROOT_DIR=... -DOUTPUT=... -P check_glyph_table.cmake
+
+execute_process(
+  COMMAND ${PYTHON} ${ROOT_DIR}/build/gen_glyph_table.py
+    ${ROOT_DIR}/build/charset_mapping.txt ${OUTPUT}
+  RESULT_VARIABLE result)
+
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "gen_glyph_table.py failed")
+endif()
+
+execute_process(
+  COMMAND ${CMAKE_COMMAND} -E compare_files
+    ${OUTPUT} ${ROOT_DIR}/source/data/glyph_table.cpp
+  RESULT_VARIABLE result)
+
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "source/data/glyph_table.cpp is out of date, "
+    "regenerate it with build/gen_glyph_table.py")
+endif()
@@ -0,0 +1,56 @@
+#include "compression_samples.hpp"
+#include "platform/gba/gba_platform_compression.hpp"
+#include <chrono>
+
+
+// Times the lz77 and run-length decoders on the files in a bundle that
+// compression_samples.lua wrote. On the gba, the bios decompresses files, and
+// the desktop platform uses these decoders instead, so this tells us what
+// compression costs the desktop build, and how well each format compresses
+// each kind of data.
+//
+// compression_bench bundle.bin
+
+
+int main(int argc, char** argv)
+{
+    SampleBundle bundle;
+    if (argc not_eq 2 or not bundle.load(argv[1])) {
+        fprintf(stderr, "usage: compression_bench bundle.bin\n");
+        return 1;
+    }
+
+    for (auto& file : bundle.files_) {
+        const auto compression = compression_of(file.data_);
+        if (compression == Compression::none) {
+            continue;
+        }
+
+        const auto stream = compressed_stream(file.data_);
+        const u32 size = decompressed_size(stream);
+
+        std::vector<u8> out(size);
+
+        const int iterations = 1 + (64 << 20) / (size + 1);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            if (compression == Compression::lz77) {
+                lz77_decompress(stream, out.data());
+            } else {
+                rle_decompress(stream, out.data());
+            }
+        }
+        const auto stop = std::chrono::steady_clock::now();
+
+        const double seconds =
+            std::chrono::duration<double>(stop - start).count();
+
+        printf("%-16s %6u -> %6u bytes (%5.1f%%), %8.1f MB/s\n",
+               file.name_.c_str(),
+               size,
+               file.data_.size_,
+               100.0 * file.data_.size_ / size,
+               double(size) * iterations / seconds / (1 << 20));
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+
+#include "filesystem.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+// Loads a bundle written by compression_samples.lua, and walks its files the
+// same way as Filesystem::get_file(), see filesystem.cpp.
+struct SampleBundle {
+    struct File {
+        std::string name_;
+        Filesystem::FileData data_;
+    };
+
+    // Words, so that the bundle starts at a word boundary, like the rom.
+    std::vector<u32> storage_;
+    std::vector<File> files_;
+
+
+    bool load(const char* path)
+    {
+        auto f = fopen(path, "rb");
+        if (f == nullptr) {
+            return false;
+        }
+
+        std::vector<char> bytes;
+        int c;
+        while ((c = fgetc(f)) not_eq EOF) {
+            bytes.push_back(c);
+        }
+        fclose(f);
+
+        storage_.resize(bytes.size() / 4 + 1);
+        memcpy(storage_.data(), bytes.data(), bytes.size());
+
+        const char* current = (const char*)storage_.data();
+        const char* end = current + bytes.size();
+
+        while (current + 48 <= end and current[0] not_eq '\0') {
+            File file;
+            file.name_ = std::string(current, strnlen(current, 32));
+            file.data_.data_ = current + 48;
+            file.data_.size_ = atoi(current + 32);
+            file.data_.compression_ = current[47];
+            files_.push_back(file);
+
+            u32 skip = file.data_.size_ + 1; // +1 for null terminator
+            skip += skip % 4;                // word padding
+
+            current += 48 + skip;
+        }
+
+        return current + 48 <= end;
+    }
+};
@@ -0,0 +1,91 @@
+#!/usr/bin/env lua
+---
+--- Writes a resource bundle of sample files, each one bundled as-is, and
+--- compressed with lz77 and with run-length encoding, using build.lua's
+--- compressors and bundle writer. compression_test.cpp checks that the
+--- engine's decoders reproduce the original files, and compression_bench.cpp
+--- times the decoders:
+---
+--- lua compression_samples.lua path/to/build.lua bundle.bin
+---
+
+
+bpcore_build_functions_only = true
+dofile(arg[1])
+
+
+-- Pseudo-random, so that the samples come out the same everywhere.
+local seed = 1
+local function random(n)
+   seed = (seed * 1103515245 + 12345) % 2147483648
+   return seed // 65536 % n
+end
+
+
+local function bytes(count, fn)
+   local out = {}
+   for i = 0, count - 1 do
+      out[#out + 1] = string.char(fn(i))
+   end
+   return table.concat(out)
+end
+
+
+-- 4bpp tiles, mostly a repeating pattern, with some variation, like a
+-- tileset.
+local tiles = bytes(16384, function(i)
+   local tile = i // 32
+   if tile % 7 == 0 then
+      return random(256)
+   end
+   return (i % 4) * 17 + (tile % 5)
+end)
+
+
+local runs = {}
+while #runs < 600 do
+   runs[#runs + 1] = string.rep(string.char(random(256)), 1 + random(200))
+end
+runs = table.concat(runs):sub(1, 24000)
+
+
+local samples = {
+   { "tiles", tiles },
+   { "script", contents(arg[1]):sub(1, 20000) },
+   { "noise", bytes(4096, function() return random(256) end) },
+   { "runs", runs },
+   { "zeros", string.rep("\0", 5000) },
+   { "tiny", "abc" },
+   { "odd", bytes(4097, function(i) return i % 13 end) },
+
+   -- Uncompressed files that happen to start with what used to be the
+   -- compression tags.
+   { "lz77_text", "LZ77 is not a tag anymore, this file is plain text.\n" },
+   { "rle_text", "RLE text, also not compressed." },
+}
+
+
+local path = os.tmpname()
+
+local function bundle_sample(name, data, method)
+   local file = assert(io.open(path, "wb"))
+   file:write(compress(data, method))
+   file:close()
+   bundle_file(name, path, method)
+end
+
+
+bundle = assert(io.open(arg[2], "wb"))
+
+for _, sample in ipairs(samples) do
+   local name, data = sample[1], sample[2]
+   bundle_sample(name, data)
+   bundle_sample(name .. ".lz77", data, "lz77")
+   bundle_sample(name .. ".rle", data, "rle")
+end
+
+-- An empty header ends the bundle.
+bundle:write(string.rep("\0", 48))
+bundle:close()
+
+os.remove(path)
@@ -0,0 +1,90 @@
+#include "compression_samples.hpp"
+#include "platform/gba/gba_platform_compression.hpp"
+#include "test.hpp"
+#include <map>
+
+
+// Decompresses every file in a bundle that compression_samples.lua wrote with
+// build.lua, and compares it with the uncompressed copy of the same file.
+//
+// compression_test bundle.bin
+
+
+static bool ends_with(const std::string& str, const std::string& suffix)
+{
+    return str.size() >= suffix.size() and
+           str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc not_eq 2) {
+        fprintf(stderr, "usage: compression_test bundle.bin\n");
+        return 1;
+    }
+
+    SampleBundle bundle;
+    CHECK(bundle.load(argv[1]));
+    CHECK(bundle.files_.size() == 27);
+
+    std::map<std::string, Filesystem::FileData> originals;
+    for (auto& file : bundle.files_) {
+        if (not ends_with(file.name_, ".lz77") and
+            not ends_with(file.name_, ".rle")) {
+            originals[file.name_] = file.data_;
+
+            // Uncompressed files are uncompressed, whatever their contents.
+            CHECK(compression_of(file.data_) == Compression::none);
+        }
+    }
+
+    int checked = 0;
+
+    for (auto& file : bundle.files_) {
+        const auto& f = file.data_;
+
+        Compression expected;
+        std::string original_name;
+
+        if (ends_with(file.name_, ".lz77")) {
+            expected = Compression::lz77;
+            original_name = file.name_.substr(0, file.name_.size() - 5);
+        } else if (ends_with(file.name_, ".rle")) {
+            expected = Compression::rle;
+            original_name = file.name_.substr(0, file.name_.size() - 4);
+        } else {
+            continue;
+        }
+
+        CHECK(compression_of(f) == expected);
+
+        const auto& original = originals[original_name];
+
+        // The bios needs word-aligned data.
+        const auto stream = compressed_stream(f);
+        CHECK(uintptr_t(stream) % 4 == 0);
+        CHECK(stream >= (const u8*)f.data_ and stream < (const u8*)f.data_ + 4);
+        CHECK(stream[0] == f.compression_);
+
+        CHECK(decompressed_size(stream) == original.size_);
+
+        std::vector<u8> out(original.size_ + 16, 0xcd);
+        if (expected == Compression::lz77) {
+            lz77_decompress(stream, out.data());
+        } else {
+            rle_decompress(stream, out.data());
+        }
+
+        CHECK(memcmp(out.data(), original.data_, original.size_) == 0);
+
+        // Nothing past the end.
+        CHECK(out[original.size_] == 0xcd);
+
+        ++checked;
+    }
+
+    CHECK(checked == 18);
+
+    return test_result("compression_test");
+}
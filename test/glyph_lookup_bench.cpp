@@ -0,0 +1,75 @@
+#include "platform/platform.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+
+// Defined in localization.cpp.
+std::optional<Platform::TextureMapping>
+standard_texture_map(const utf8::Codepoint& cp);
+
+
+// Measures the codepoint to glyph lookup that map_glyph calls for every
+// character that misses the glyph cache. Ascii goes through the direct table,
+// everything else through the binary search.
+
+
+static std::vector<utf8::Codepoint> codepoints(const char* text)
+{
+    std::vector<utf8::Codepoint> result;
+    utf8::scan([&](const utf8::Codepoint& cp,
+                   const char*,
+                   int) { result.push_back(cp); },
+               text,
+               strlen(text));
+    return result;
+}
+
+
+static void report(const char* name, const char* text)
+{
+    const auto cps = codepoints(text);
+    const int iterations = 200000;
+
+    int found = 0;
+    int checksum = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (auto cp : cps) {
+            if (const auto mapping = standard_texture_map(cp)) {
+                ++found;
+                checksum += mapping->offset_;
+            }
+        }
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    const double ns =
+        std::chrono::duration<double, std::nano>(stop - start).count();
+
+    const long total = long(iterations) * cps.size();
+
+    printf("%-8s %6.2f ns/lookup, %5.1f%% found (checksum %d)\n",
+           name,
+           ns / total,
+           100.0 * found / total,
+           checksum);
+}
+
+
+int main(int, char**)
+{
+    report("ascii",
+           "The merchant squints at you. \"Forty gold for the lantern, "
+           "and not a coin less. Take it or leave it.\"");
+
+    report("latin1",
+           "¿Dónde está la llave? Ça alors! Le garçon a retrouvé la clé "
+           "près de la fenêtre, à côté du vieux piano français.");
+
+    report("cjk",
+           "我想你在这里很快就会见到他。小岛上没有别的路，我们可以一起走过去。"
+           "カタナヲ ミツケタ! コレデ タタカエル。");
+}
@@ -0,0 +1,103 @@
+#include "platform/platform.hpp"
+#include "test.hpp"
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+
+
+// Defined in localization.cpp.
+std::optional<Platform::TextureMapping>
+standard_texture_map(const utf8::Codepoint& cp);
+
+
+// Packs the utf-8 bytes of a character into a little-endian integer, the same
+// way that utf8::scan does.
+static utf8::Codepoint pack(const std::string& bytes)
+{
+    utf8::Codepoint result = 0;
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        result |= utf8::Codepoint(u8(bytes[i])) << (8 * i);
+    }
+    return result;
+}
+
+
+static std::string encode(u32 cp)
+{
+    std::string result;
+    if (cp < 0x80) {
+        result += char(cp);
+    } else if (cp < 0x800) {
+        result += char(0xc0 | (cp >> 6));
+        result += char(0x80 | (cp & 0x3f));
+    } else {
+        result += char(0xe0 | (cp >> 12));
+        result += char(0x80 | ((cp >> 6) & 0x3f));
+        result += char(0x80 | (cp & 0x3f));
+    }
+    return result;
+}
+
+
+// Parses build/charset_mapping.txt with the same rules as
+// build/gen_glyph_table.py: glyphs may be written as U+XXXX, and the first
+// mapping for a glyph wins.
+static std::map<utf8::Codepoint, u16> read_mappings(int& line_count)
+{
+    std::map<utf8::Codepoint, u16> result;
+
+    std::ifstream in(CHARSET_MAPPING_FILE);
+    CHECK(in.good());
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() or line[0] == '#') {
+            continue;
+        }
+
+        ++line_count;
+
+        const auto space = line.rfind(' ');
+        auto glyph = line.substr(0, space);
+        const int index = std::stoi(line.substr(space + 1));
+
+        if (glyph.size() > 2 and glyph.compare(0, 2, "U+") == 0) {
+            glyph = encode(std::stoul(glyph.substr(2), nullptr, 16));
+        }
+
+        result.insert({pack(glyph), index});
+    }
+
+    return result;
+}
+
+
+int main(int, char**)
+{
+    int line_count = 0;
+    const auto mappings = read_mappings(line_count);
+
+    CHECK(line_count == 2774);
+
+    for (auto& [cp, index] : mappings) {
+        const auto mapping = standard_texture_map(cp);
+        CHECK(mapping and mapping->offset_ == index);
+        CHECK(mapping and strcmp(mapping->texture_name_, "charset") == 0);
+
+        // The neighbouring keys exercise the misses in the binary search.
+        for (auto other : {cp - 1, cp + 1, cp + 0x100}) {
+            if (mappings.find(other) == mappings.end()) {
+                CHECK(not standard_texture_map(other));
+            }
+        }
+    }
+
+    for (utf8::Codepoint cp = 0; cp < 128; ++cp) {
+        if (mappings.find(cp) == mappings.end()) {
+            CHECK(not standard_texture_map(cp));
+        }
+    }
+
+    return test_result("glyph_mapping_test");
+}
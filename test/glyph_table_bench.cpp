@@ -0,0 +1,182 @@
+#include "platform/gba/gba_platform_glyphtable.hpp"
+#include "platform/platform.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+
+// Defined in localization.cpp.
+std::optional<Platform::TextureMapping>
+standard_texture_map(const utf8::Codepoint& cp);
+
+
+// Prints pages of dialog into a text box, the way a script would with print(),
+// and measures how quickly the glyph table maps characters. Each new page
+// releases the glyphs of the previous one, like Platform::set_tile does when
+// a script overwrites the text box. Everything except the vram copies runs
+// the same code as Platform::map_glyph.
+
+
+static const char* const english[] = {
+    "Welcome back! The harbor has been quiet since the storm. "
+    "Will you help us repair the lighthouse before nightfall?",
+    "You found 3 copper coins, a rusty key, and a note: "
+    "\"Meet me at the old mill, 9 o'clock. Don't be late.\"",
+    "The merchant squints at you. \"Forty gold for the lantern, "
+    "and not a coin less. Take it or leave it.\"",
+};
+
+
+static const char* const latin1[] = {
+    "¿Dónde está la llave? Según el capitán, "
+    "la dejó junto al baúl en la habitación número 2.",
+    "Ça alors! Le garçon a retrouvé la clé près de la fenêtre, "
+    "à côté du vieux piano français.",
+    "Hinter der Brücke, links: dort wartet Jürgen mit "
+    "dem Schlüssel für die Türen.",
+};
+
+
+static const char* const cjk[] = {
+    "我想你在这里很快就会见到他。小岛上没有别的路，"
+    "我们可以一起走过去。",
+    "前面的桥很脆，小心慢走。过了桥就是北边的湖，"
+    "湖边有一条小路。",
+    "カタナヲ ミツケタ! コレデ タタカエル。"
+    "ツギハ キタノ ミズウミヘ ムカオウ。",
+};
+
+
+// Six pages of thirty different characters each, more than the table can hold,
+// so every page evicts the glyphs of older ones.
+static const char* const cjk_churn[] = {
+    "届俊垫酸层狮观滋伙卖回遥拜突壳辆销颗楼此照舰很脆漫题小吧案北",
+    "圈需弗玲绕函就湖逢穗谐校皂谜灰纯平鸭澳稀扬喻丽污兄口恋探合轴",
+    "叠凉役虚落碰慨亏节帅减政腰雅但筹败列弥声漂义瓢灌渔炒觉猜邀部",
+    "识挺欢说乙每岛宜早夺胶妥虑酿巾垃析钾勉顽及易偷拇聚漏划弃障搭",
+    "积送旨满沾脉置猎驶扮橙炼邻烤悔谊来买奋窝骂闲丝句继业过真插洁",
+    "万卸",
+};
+
+
+struct Result {
+    long chars_ = 0;
+    long hits_ = 0;
+    long misses_ = 0;
+    long failures_ = 0;
+    long flushes_ = 0;
+};
+
+
+// A four line text box, like most dialog in the example project.
+static constexpr int box_cells = 4 * 28;
+
+
+static int map_glyph(GlyphTable& table, utf8::Codepoint cp, Result& result)
+{
+    if (const int slot = table.lookup(cp); slot not_eq -1) {
+        ++result.hits_;
+        return slot;
+    }
+
+    const auto mapping = standard_texture_map(cp);
+    if (not mapping) {
+        ++result.failures_;
+        return -1;
+    }
+
+    const int t = table.assign(cp);
+    if (t == -1) {
+        ++result.failures_;
+        return -1;
+    }
+
+    ++result.misses_;
+
+    PendingGlyph pending;
+    pending.offset_ = mapping->offset_;
+    pending.bin_ = 0;
+    pending.slot_ = t;
+
+    if (not table.enqueue(pending)) {
+        ++result.flushes_;
+        table.pending_count_ = 0;
+        table.enqueue(pending);
+    }
+
+    return t;
+}
+
+
+static Result run(const char* const* pages, int page_count, int iterations)
+{
+    static GlyphTable table;
+    table.reset();
+
+    int box[box_cells];
+    for (auto& cell : box) {
+        cell = -1;
+    }
+
+    Result result;
+
+    for (int iter = 0; iter < iterations; ++iter) {
+        const char* page = pages[iter % page_count];
+
+        for (auto& cell : box) {
+            if (cell not_eq -1) {
+                --table.mappings_[cell].reference_count_;
+                cell = -1;
+            }
+        }
+
+        int cell = 0;
+        utf8::scan(
+            [&](const utf8::Codepoint& cp, const char*, int) {
+                ++result.chars_;
+                const int slot = map_glyph(table, cp, result);
+                if (slot not_eq -1 and cell < box_cells) {
+                    ++table.mappings_[slot].reference_count_;
+                    box[cell++] = slot;
+                }
+            },
+            page,
+            strlen(page));
+
+        // Once per frame, the platform copies the queued glyphs into vram.
+        table.pending_count_ = 0;
+    }
+
+    return result;
+}
+
+
+static void report(const char* name, const char* const* pages, int count)
+{
+    const int iterations = 200000;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto result = run(pages, count, iterations);
+    const auto stop = std::chrono::steady_clock::now();
+
+    const double ns =
+        std::chrono::duration<double, std::nano>(stop - start).count();
+
+    printf("%-8s %6.1f ns/char, hit rate %5.1f%%, "
+           "%ld misses, %ld failed, %ld flushes\n",
+           name,
+           ns / result.chars_,
+           100.0 * result.hits_ / result.chars_,
+           result.misses_,
+           result.failures_,
+           result.flushes_);
+}
+
+
+int main(int, char**)
+{
+    report("english", english, 3);
+    report("latin1", latin1, 3);
+    report("cjk", cjk, 3);
+    report("churn", cjk_churn, 6);
+}
@@ -0,0 +1,125 @@
+#include "platform/gba/gba_platform_glyphtable.hpp"
+#include "test.hpp"
+
+
+// Every assigned slot must be reachable through the hash table, and the table
+// must not hold anything else.
+static void check_consistent(const GlyphTable& table)
+{
+    int entries = 0;
+    for (auto entry : table.table_) {
+        if (entry not_eq GlyphTable::empty) {
+            ++entries;
+            CHECK(table.mappings_[entry].valid());
+        }
+    }
+
+    int valid = 0;
+    for (int t = 0; t < glyph_mapping_count; ++t) {
+        const auto& gm = table.mappings_[t];
+        if (gm.valid()) {
+            ++valid;
+            const int i = table.find(gm.character_);
+            CHECK(i not_eq -1 and table.table_[i] == t);
+        }
+    }
+
+    CHECK(entries == valid);
+}
+
+
+// Cycle through many more codepoints than we have slots, so that evictions
+// exercise the backward-shift deletion, including runs that wrap around the
+// end of the table.
+static void test_eviction_keeps_table_consistent()
+{
+    static GlyphTable table;
+    table.reset();
+
+    u32 seed = 1;
+    for (int i = 0; i < 20000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        const utf8::Codepoint cp = 0x20 + (seed >> 16) % 400;
+
+        if (table.lookup(cp) == -1) {
+            CHECK(table.assign(cp) not_eq -1);
+        }
+        CHECK(table.lookup(cp) not_eq -1);
+
+        if (i % 256 == 0) {
+            check_consistent(table);
+        }
+    }
+
+    check_consistent(table);
+}
+
+
+// Once the table fills up, we evict the least recently used glyph, but never
+// one that's still on screen.
+static void test_lru_skips_referenced()
+{
+    static GlyphTable table;
+    table.reset();
+
+    for (int i = 0; i < glyph_mapping_count; ++i) {
+        CHECK(table.lookup(1000 + i) == -1);
+        CHECK(table.assign(1000 + i) == i);
+    }
+
+    // Slot zero is the oldest, but something refers to it.
+    ++table.mappings_[0].reference_count_;
+
+    // Touching slot two makes slot one the least recently used.
+    table.lookup(1002);
+
+    table.lookup(5000);
+    CHECK(table.assign(5000) == 1);
+    CHECK(table.lookup(1001) == -1);
+    CHECK(table.lookup(1000) == 0);
+
+    for (auto& gm : table.mappings_) {
+        ++gm.reference_count_;
+    }
+
+    CHECK(table.assign(5001) == -1);
+
+    check_consistent(table);
+}
+
+
+// Re-assigning a slot replaces its queued upload, rather than queueing a
+// second one.
+static void test_enqueue()
+{
+    static GlyphTable table;
+    table.reset();
+
+    PendingGlyph pending;
+    pending.bin_ = 0;
+
+    for (int i = 0; i < GlyphTable::max_pending; ++i) {
+        pending.slot_ = i;
+        pending.offset_ = i;
+        CHECK(table.enqueue(pending));
+    }
+
+    pending.slot_ = 3;
+    pending.offset_ = 100;
+    CHECK(table.enqueue(pending));
+    CHECK(table.pending_count_ == GlyphTable::max_pending);
+    CHECK(table.pending_[3].offset_ == 100);
+
+    pending.slot_ = GlyphTable::max_pending;
+    CHECK(not table.enqueue(pending));
+}
+
+
+int main()
+{
+    test_eviction_keeps_table_consistent();
+    test_lru_skips_referenced();
+    test_enqueue();
+
+    return test_result("glyph_table_test");
+}
@@ -0,0 +1,103 @@
+#include "saveKv.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+extern "C" {
+#include "lua/lualib.h"
+}
+
+
+// Times the encoding that save_put() and save_get() use, on a few kinds of
+// values that games tend to save, and reports how many bytes each one takes up
+// in the 4000 byte store. save_put() encodes a value twice, once to measure it
+// and once to write it, so the encode times below include both passes.
+
+
+struct Sample {
+    const char* name_;
+    const char* value_;
+};
+
+
+static const Sample samples[] = {
+    {"settings", "return {volume = 7, music = true, lang = 'en', speed = 2}"},
+    {"player",
+     "return {name = 'Hero', hp = 120, max_hp = 150, gold = 48213,"
+     "        pos = {x = 104.5, y = -12.25, room = 17},"
+     "        flags = {met_king = true, has_boat = false, chapter = 3}}"},
+    {"inventory",
+     "local t = {} for i = 1, 40 do t[i] = {id = i * 7, count = i % 9} end "
+     "return t"},
+    {"map", "local t = {} for i = 1, 256 do t[i] = i % 3 == 0 end return t"},
+    {"scores",
+     "local t = {} for i = 1, 100 do t[i] = i * 1013 end return t"},
+    {"text",
+     "return 'The lighthouse keeper asked you to bring back the lantern "
+     "from the old mill, before the storm reaches the harbor.'"},
+};
+
+
+template <typename F> static double time_ns(int iterations, F&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        f();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           iterations;
+}
+
+
+int main(int, char**)
+{
+    lua_State* L = luaL_newstate();
+    luaL_openlibs(L);
+
+    printf("%-10s %6s %10s %10s\n", "value", "bytes", "encode", "decode");
+
+    for (auto& sample : samples) {
+        if (luaL_dostring(L, sample.value_)) {
+            fprintf(stderr, "%s\n", lua_tostring(L, -1));
+            return 1;
+        }
+
+        SaveWriter measure{nullptr};
+        measure.put_value(L, -1, 0);
+
+        std::vector<u8> buffer(measure.size_);
+
+        const int iterations = 20000;
+
+        const double encode = time_ns(iterations, [&] {
+            SaveWriter counter{nullptr};
+            counter.put_value(L, -1, 0);
+            SaveWriter writer{buffer.data()};
+            writer.put_value(L, -1, 0);
+        });
+
+        bool ok = true;
+        const double decode = time_ns(iterations, [&] {
+            SaveReader reader{buffer.data(), buffer.data() + buffer.size()};
+            ok = ok and reader.get_value(L, 0);
+            lua_pop(L, 1);
+        });
+
+        if (not ok) {
+            fprintf(stderr, "%s: failed to decode\n", sample.name_);
+            return 1;
+        }
+
+        printf("%-10s %6d %8.0fns %8.0fns\n",
+               sample.name_,
+               measure.size_,
+               encode,
+               decode);
+
+        lua_pop(L, 1);
+    }
+
+    lua_close(L);
+}
@@ -0,0 +1,346 @@
+#include "saveKv.hpp"
+#include "test.hpp"
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "lua/lualib.h"
+}
+
+
+// Round-trips values through the encoding that save_put() and save_get() use,
+// and through the store's entries and header, with the same lua configuration
+// as the engine. The scripts below call put() and get(), which work like
+// save_put() and save_get(), on whichever entries the test points them at.
+
+
+static SaveEntries* entries;
+
+
+static int put(lua_State* L)
+{
+    size_t key_len;
+    const char* key = luaL_checklstring(L, 1, &key_len);
+    entries->put(L, key, key_len, 2);
+    return 0;
+}
+
+
+static int get(lua_State* L)
+{
+    size_t key_len;
+    const char* key = luaL_checklstring(L, 1, &key_len);
+    entries->get(L, key, key_len);
+    return 1;
+}
+
+
+static const char* const prelude =
+    "function same(a, b)"
+    "  if type(a) ~= 'table' or type(b) ~= 'table' then"
+    "    return math.type(a) == math.type(b) and a == b"
+    "  end"
+    "  for k, v in pairs(a) do"
+    "    if not same(v, b[k]) then return false end"
+    "  end"
+    "  for k in pairs(b) do"
+    "    if a[k] == nil then return false end"
+    "  end"
+    "  return true "
+    "end "
+    "function nest(n)"
+    "  local t = {leaf = true}"
+    "  for i = 2, n do t = {t} end"
+    "  return t "
+    "end";
+
+
+// Runs a chunk, and returns the error message, or an empty string if the chunk
+// ran without errors. Leaves the stack as it was.
+static std::string run(lua_State* L, const char* chunk)
+{
+    const int top = lua_gettop(L);
+    std::string error;
+    if (luaL_dostring(L, chunk)) {
+        error = lua_tostring(L, -1);
+    }
+    lua_settop(L, top);
+    return error;
+}
+
+
+static bool holds(lua_State* L, const char* expr)
+{
+    const std::string chunk = std::string("assert(") + expr + ")";
+    const std::string error = run(L, chunk.c_str());
+    if (not error.empty()) {
+        fprintf(stderr, "%s\n", error.c_str());
+    }
+    return error.empty();
+}
+
+
+static bool raises(lua_State* L, const char* chunk, const char* message)
+{
+    return run(L, chunk).find(message) not_eq std::string::npos;
+}
+
+
+// Encodes a value, checks its size and tag, and reads it back, through the
+// store, and directly, from the encoding.
+static void round_trip(lua_State* L, const char* expr, int size, u8 tag)
+{
+    const int failures = test_failures;
+
+    std::vector<u8> store(4000);
+    SaveEntries kv{store.data(), int(store.size())};
+    entries = &kv;
+
+    const std::string value = std::string("return ") + expr;
+    CHECK(luaL_dostring(L, value.c_str()) == 0);
+    const int top = lua_gettop(L);
+
+    SaveWriter measure{nullptr};
+    measure.put_value(L, -1, 0);
+    CHECK(measure.size_ == size);
+
+    std::vector<u8> buffer(measure.size_);
+    SaveWriter writer{buffer.data()};
+    writer.put_value(L, -1, 0);
+    CHECK(writer.size_ == measure.size_);
+    CHECK(buffer[0] == tag);
+
+    SaveReader reader{buffer.data(), buffer.data() + buffer.size()};
+    CHECK(reader.get_value(L, 0));
+    CHECK(reader.pos_ == reader.end_);
+    CHECK(lua_gettop(L) == top + 1);
+    lua_setglobal(L, "decoded");
+    lua_setglobal(L, "expected");
+    CHECK(holds(L, "same(decoded, expected)"));
+
+    // Key, as a short string, followed by the value.
+    CHECK(run(L, "put('k', expected)").empty());
+    CHECK(kv.length_ == 2 + size);
+    CHECK(holds(L, "same(get('k'), expected)"));
+
+    if (test_failures not_eq failures) {
+        fprintf(stderr, "  while round-tripping %s\n", expr);
+    }
+}
+
+
+static void test_round_trip(lua_State* L)
+{
+    round_trip(L, "false", 1, save_tag_false);
+    round_trip(L, "true", 1, save_tag_true);
+
+    round_trip(L, "0", 1, save_tag_small_int | 0);
+    round_trip(L, "127", 1, save_tag_small_int | 127);
+    round_trip(L, "128", 3, save_tag_int);
+    round_trip(L, "8191", 3, save_tag_int);
+    round_trip(L, "8192", 4, save_tag_int);
+    round_trip(L, "-1", 2, save_tag_int);
+    round_trip(L, "-64", 2, save_tag_int);
+    round_trip(L, "-65", 3, save_tag_int);
+    round_trip(L, "math.maxinteger", 6, save_tag_int);
+    round_trip(L, "math.mininteger", 6, save_tag_int);
+
+    round_trip(L, "0.0", 5, save_tag_float);
+    round_trip(L, "-12.25", 5, save_tag_float);
+    round_trip(L, "128.5", 5, save_tag_float);
+    round_trip(L, "1e30", 5, save_tag_float);
+    round_trip(L, "-math.huge", 5, save_tag_float);
+
+    round_trip(L, "''", 1, save_tag_short_string);
+    round_trip(L, "'a\\0b'", 4, save_tag_short_string | 3);
+    round_trip(L, "('x'):rep(31)", 32, save_tag_short_string | 31);
+    round_trip(L, "('x'):rep(32)", 34, save_tag_string);
+    round_trip(L, "('x'):rep(127)", 129, save_tag_string);
+    round_trip(L, "('x'):rep(128)", 131, save_tag_string);
+
+    round_trip(L, "{}", 2, save_tag_table);
+    round_trip(L, "{1, 2, 3}", 8, save_tag_table);
+    round_trip(L,
+               "{a = {b = {c = 'd'}}, [1.5] = true, [false] = -7,"
+               " list = {1000, 'two', {}}}",
+               42,
+               save_tag_table);
+
+    // The deepest table that the store accepts.
+    round_trip(L, "nest(save_kv_max_depth)", 53, save_tag_table);
+}
+
+
+static void test_delete(lua_State* L)
+{
+    std::vector<u8> store(4000);
+    SaveEntries kv{store.data(), int(store.size())};
+    entries = &kv;
+
+    CHECK(run(L, "put('a', 1) put('b', {x = 2}) put('c', 'three')").empty());
+    const int length = kv.length_;
+
+    // Deleting a key that isn't there does nothing.
+    CHECK(run(L, "put('d', nil)").empty());
+    CHECK(kv.length_ == length);
+
+    CHECK(run(L, "put('b', nil)").empty());
+    CHECK(kv.length_ == length - 7);
+    CHECK(holds(L, "get('a') == 1 and get('b') == nil"));
+    CHECK(holds(L, "get('c') == 'three'"));
+
+    // Overwriting a key replaces its entry, rather than adding another.
+    CHECK(run(L, "put('a', 'one') put('a', 'uno')").empty());
+    CHECK(kv.length_ == length - 7 - 1 + 4);
+    CHECK(holds(L, "get('a') == 'uno' and get('c') == 'three'"));
+
+    CHECK(run(L, "put('a', nil) put('c', nil)").empty());
+    CHECK(kv.length_ == 0);
+    CHECK(holds(L, "get('a') == nil and get('c') == nil"));
+}
+
+
+static void test_full(lua_State* L)
+{
+    std::vector<u8> store(64);
+    SaveEntries kv{store.data(), int(store.size())};
+    entries = &kv;
+
+    // Two bytes of key, then two bytes of string header.
+    CHECK(run(L, "put('a', ('x'):rep(50))").empty());
+    const int length = kv.length_;
+
+    CHECK(raises(L, "put('b', ('y'):rep(10))", "save_put: save data full"));
+    CHECK(kv.length_ == length);
+    CHECK(holds(L, "get('a') == ('x'):rep(50) and get('b') == nil"));
+
+    // The store counts the space of the value that a put replaces.
+    CHECK(raises(L, "put('a', ('z'):rep(61))", "save_put: save data full"));
+    CHECK(kv.length_ == length);
+    CHECK(holds(L, "get('a') == ('x'):rep(50)"));
+
+    CHECK(run(L, "put('a', ('z'):rep(60))").empty());
+    CHECK(kv.length_ == kv.capacity_);
+    CHECK(holds(L, "get('a') == ('z'):rep(60)"));
+}
+
+
+static void test_too_deep(lua_State* L)
+{
+    std::vector<u8> store(4000);
+    SaveEntries kv{store.data(), int(store.size())};
+    entries = &kv;
+
+    CHECK(run(L, "put('a', {1, 2})").empty());
+    const int length = kv.length_;
+
+    const char* const message = "save_put: tables nested too deeply";
+    CHECK(raises(L, "put('a', nest(save_kv_max_depth + 1))", message));
+    CHECK(raises(L, "local t = {} t.t = t put('a', t)", message));
+    CHECK(raises(L, "local t = {} t[t] = 1 put('b', t)", message));
+    CHECK(raises(L,
+                 "put('b', {function() end})",
+                 "save_put: cannot save a function"));
+
+    CHECK(kv.length_ == length);
+    CHECK(holds(L, "same(get('a'), {1, 2}) and get('b') == nil"));
+
+    // A reader must not accept data that the writer would have refused.
+    std::vector<u8> deep;
+    for (int i = 0; i < save_kv_max_depth + 1; ++i) {
+        deep.push_back(save_tag_table);
+    }
+    deep.insert(deep.end(), save_kv_max_depth + 1, save_tag_end);
+
+    const int top = lua_gettop(L);
+    SaveReader reader{deep.data(), deep.data() + deep.size()};
+    CHECK(not reader.get_value(L, 0));
+    CHECK(lua_gettop(L) == top);
+}
+
+
+static void test_corrupt(lua_State* L)
+{
+    std::vector<u8> store(save_kv_header + 256);
+    SaveEntries kv{store.data() + save_kv_header,
+                   int(store.size()) - save_kv_header};
+    entries = &kv;
+
+    CHECK(save_kv_verify(store.data(), store.size()) == -1);
+
+    CHECK(run(L, "put('a', {b = {1, 2.5, 'three'}, c = true})").empty());
+    CHECK(run(L, "put('d', 'four')").empty());
+    save_kv_seal(store.data(), kv.length_);
+    CHECK(save_kv_verify(store.data(), store.size()) == kv.length_);
+
+    // The header covers the entries, but not the rest of the buffer.
+    const std::vector<u8> sealed = store;
+    store.back() ^= 1;
+    CHECK(save_kv_verify(store.data(), store.size()) == kv.length_);
+
+    for (int i = 0; i < save_kv_header + kv.length_; ++i) {
+        store = sealed;
+        store[i] ^= 0x10;
+        CHECK(save_kv_verify(store.data(), store.size()) == -1);
+    }
+
+    // The platform read less than the header says that we wrote.
+    store = sealed;
+    const int total = save_kv_header + kv.length_;
+    CHECK(save_kv_verify(store.data(), total) == kv.length_);
+    CHECK(save_kv_verify(store.data(), total - 1) == -1);
+    CHECK(save_kv_verify(store.data(), save_kv_header - 1) == -1);
+
+    // A value cut short, anywhere, fails to decode, and leaves nothing on the
+    // stack, however deep into a table the data ends.
+    const u8* value = store.data() + save_kv_header + 2;
+    const int value_size = kv.length_ - 2 - 7;
+    const int top = lua_gettop(L);
+    for (int n = 0; n < value_size; ++n) {
+        SaveReader reader{value, value + n};
+        CHECK(not reader.get_value(L, 0));
+        CHECK(lua_gettop(L) == top);
+
+        SaveReader skip{value, value + n};
+        CHECK(not skip.get_value(nullptr, 0));
+    }
+
+    SaveReader reader{value, value + value_size};
+    CHECK(reader.get_value(L, 0));
+    CHECK(lua_gettop(L) == top + 1);
+    lua_settop(L, top);
+
+    // A store with a truncated entry does not hand out a partial value.
+    kv.length_ -= 3;
+    CHECK(holds(L, "get('a') ~= nil and get('d') == nil"));
+}
+
+
+int main(int, char**)
+{
+    lua_State* L = luaL_newstate();
+    luaL_openlibs(L);
+
+    lua_register(L, "put", put);
+    lua_register(L, "get", get);
+    lua_pushinteger(L, save_kv_max_depth);
+    lua_setglobal(L, "save_kv_max_depth");
+
+    if (not run(L, prelude).empty()) {
+        fprintf(stderr, "bad prelude\n");
+        return 1;
+    }
+
+    test_round_trip(L);
+    test_delete(L);
+    test_full(L);
+    test_too_deep(L);
+    test_corrupt(L);
+
+    CHECK(lua_gettop(L) == 0);
+
+    lua_close(L);
+
+    return test_result("save_kv");
+}
@@ -0,0 +1,113 @@
+#include "platform/gba/gba_platform_flashsim.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+
+// Runs a few save patterns through the flash save store, on a simulated chip,
+// and reports what each save costs: bytes programmed, sector erases, the write
+// amplification (bytes programmed per byte that changed), and the time that
+// the chip would spend busy, from the datasheet timings in SimulatedFlash.
+
+
+static const u32 save_size = 4000;
+
+
+// Pseudo-random, so that the bench does the same thing everywhere.
+static u32 seed = 1;
+static u32 random(u32 n)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % n;
+}
+
+
+struct Pattern {
+    const char* name_;
+
+    // How many bytes a save changes, at random offsets.
+    u32 changed_bytes_;
+};
+
+
+static const Pattern patterns[] = {
+    {"autosave", 4},
+    {"checkpoint", 40},
+    {"new area", 400},
+    {"everything", save_size},
+};
+
+
+int main(int, char**)
+{
+    const int saves = 2000;
+
+    printf("%-10s %8s %10s %8s %8s %10s %10s %6s\n",
+           "pattern",
+           "changed",
+           "programmed",
+           "erases",
+           "amplif.",
+           "avg",
+           "worst",
+           "wear");
+
+    for (auto& pattern : patterns) {
+        auto flash = std::make_unique<SimulatedFlash>();
+        SaveStore<SimulatedFlashBus> store{SimulatedFlashBus{flash.get()}};
+        store.mount();
+
+        std::vector<u8> save(save_size);
+        for (auto& byte : save) {
+            byte = random(256);
+        }
+        store.write(save.data(), save.size());
+
+        const u32 start_programmed = flash->bytes_programmed_;
+        const u32 start_erased = flash->sectors_erased_;
+        const u64 start_time = flash->busy_time();
+
+        u64 changed = 0;
+        u64 worst = 0;
+
+        for (int i = 0; i < saves; ++i) {
+            if (pattern.changed_bytes_ == save_size) {
+                for (auto& byte : save) {
+                    byte = byte + 1;
+                }
+            } else {
+                for (u32 j = 0; j < pattern.changed_bytes_; ++j) {
+                    auto& byte = save[random(save_size)];
+                    byte = byte + 1 + random(255);
+                }
+            }
+            changed += pattern.changed_bytes_;
+
+            const u64 before = flash->busy_time();
+            if (not store.write(save.data(), save.size())) {
+                fprintf(stderr, "%s: save %d failed\n", pattern.name_, i);
+                return 1;
+            }
+            worst = std::max(worst, flash->busy_time() - before);
+        }
+
+        const u32 programmed = flash->bytes_programmed_ - start_programmed;
+        const u32 erased = flash->sectors_erased_ - start_erased;
+        const u64 time = flash->busy_time() - start_time;
+
+        const auto wear = std::minmax_element(
+            std::begin(flash->sector_erases_), std::end(flash->sector_erases_));
+
+        printf("%-10s %8u %10u %8.3f %8.1f %8.1fms %8.1fms %3u-%u\n",
+               pattern.name_,
+               pattern.changed_bytes_,
+               programmed / saves,
+               double(erased) / saves,
+               double(programmed) / changed,
+               time / 1000.0 / saves,
+               worst / 1000.0,
+               *wear.first,
+               *wear.second);
+    }
+}
@@ -0,0 +1,325 @@
+#include "platform/gba/gba_platform_flashsim.hpp"
+#include "test.hpp"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+
+// Runs the flash save store against a simulated chip: saves read back after a
+// reboot, a power cut at any point during a save leaves either the previous
+// save or the new one, records from an interrupted save stay dead after the
+// next save, and the log wraps around the chip, compacting sectors as it goes.
+
+
+using Save = std::vector<u8>;
+
+
+static const u32 save_size = 4000;
+static const u32 save_blocks =
+    (save_size + save_record_payload - 1) / save_record_payload;
+
+
+// Pseudo-random, so that the test does the same thing everywhere.
+static u32 seed = 1;
+static u32 random(u32 n)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % n;
+}
+
+
+// Rewrite a few bytes in each of count different blocks, out of the first
+// limit blocks.
+static Save change_blocks(Save save, u32 count, u32 limit = save_blocks)
+{
+    std::vector<u32> blocks;
+    while (blocks.size() < count) {
+        const u32 block = random(limit);
+        if (std::find(blocks.begin(), blocks.end(), block) == blocks.end()) {
+            blocks.push_back(block);
+        }
+    }
+
+    for (u32 block : blocks) {
+        const u32 start = block * save_record_payload;
+        const u32 end = std::min(start + save_record_payload, save_size);
+        for (int i = 0; i < 4; ++i) {
+            auto& byte = save[start + random(end - start)];
+            byte = byte + 1 + random(255);
+        }
+    }
+
+    return save;
+}
+
+
+static Save read_back(SimulatedFlash& flash)
+{
+    SaveStore<SimulatedFlashBus> store{SimulatedFlashBus{&flash}};
+    store.mount();
+
+    Save result(save_size);
+    store.read(result.data(), save_size);
+    return result;
+}
+
+
+struct PowerCut {};
+
+
+// Loses power right after the chip finishes its cut_after'th program or erase
+// operation, by throwing out of the save store.
+struct PowerCutBus {
+    SimulatedFlash* flash_;
+    u32 cut_after_;
+    u32 operations_ = 0;
+
+    u8 read(u32 offset)
+    {
+        return flash_->read(offset);
+    }
+
+    void write(u32 offset, u8 value)
+    {
+        const u32 before = flash_->bytes_programmed_ + flash_->sectors_erased_;
+        flash_->write(offset, value);
+        const u32 after = flash_->bytes_programmed_ + flash_->sectors_erased_;
+
+        operations_ += after - before;
+        if (operations_ >= cut_after_) {
+            throw PowerCut{};
+        }
+    }
+};
+
+
+static void test_round_trip()
+{
+    SimulatedFlash flash;
+
+    // A blank chip reads as zeros.
+    CHECK(read_back(flash) == Save(save_size, 0));
+
+    SaveStore<SimulatedFlashBus> store{SimulatedFlashBus{&flash}};
+    store.mount();
+
+    Save save(save_size);
+    for (auto& byte : save) {
+        byte = random(256);
+    }
+
+    CHECK(store.write(save.data(), save.size()));
+
+    Save result(save_size);
+    store.read(result.data(), save_size);
+    CHECK(result == save);
+    CHECK(read_back(flash) == save);
+
+    // Only the changed blocks get written.
+    const u32 programmed = flash.bytes_programmed_;
+    const Save changed = change_blocks(save, 2);
+    CHECK(store.write(changed.data(), changed.size()));
+    CHECK(flash.bytes_programmed_ - programmed <= 2 * save_record_size);
+    CHECK(read_back(flash) == changed);
+
+    // Saving the same data again writes nothing at all.
+    const u32 unchanged = flash.bytes_programmed_;
+    CHECK(store.write(changed.data(), changed.size()));
+    CHECK(flash.bytes_programmed_ == unchanged);
+
+    // Too big to fit.
+    Save huge(save_store_capacity + 1);
+    CHECK(not store.write(huge.data(), huge.size()));
+    CHECK(read_back(flash) == changed);
+
+    CHECK(flash.stray_writes_ == 0);
+}
+
+
+// Cut the power after every single program and erase operation of one save,
+// on a copy of the chip, and check what the store recovers after a reboot.
+// Then save again, changing a block that the interrupted save didn't touch,
+// to check that the interrupted save's records stay dead.
+static void test_power_cuts(const SimulatedFlash& initial,
+                            const Save& before,
+                            const Save& after,
+                            const Save& next_change)
+{
+    // How many operations the uninterrupted save takes.
+    u32 operations;
+    {
+        auto flash = std::make_unique<SimulatedFlash>(initial);
+        SaveStore<SimulatedFlashBus> store{SimulatedFlashBus{flash.get()}};
+        store.mount();
+        const u32 start = flash->bytes_programmed_ + flash->sectors_erased_;
+        CHECK(store.write(after.data(), after.size()));
+        operations = flash->bytes_programmed_ + flash->sectors_erased_ - start;
+    }
+
+    int recovered_before = 0;
+    int recovered_after = 0;
+
+    for (u32 cut = 1; cut <= operations; ++cut) {
+        auto flash = std::make_unique<SimulatedFlash>(initial);
+
+        bool interrupted = false;
+        {
+            SaveStore<PowerCutBus> store{PowerCutBus{flash.get(), cut}};
+            store.mount();
+
+            // Mounting a cleanly written chip doesn't write anything, so the
+            // power cut lands somewhere in the save.
+            CHECK(flash->bytes_programmed_ == initial.bytes_programmed_);
+
+            try {
+                store.write(after.data(), after.size());
+            } catch (const PowerCut&) {
+                interrupted = true;
+            }
+        }
+
+        CHECK(interrupted);
+
+        SaveStore<SimulatedFlashBus> store{SimulatedFlashBus{flash.get()}};
+        store.mount();
+
+        Save recovered(save_size);
+        store.read(recovered.data(), save_size);
+        CHECK(recovered == before or recovered == after);
+
+        if (recovered == before) {
+            ++recovered_before;
+        } else if (recovered == after) {
+            ++recovered_after;
+        }
+
+        // The last operation programs the commit record's checksum.
+        if (cut == operations) {
+            CHECK(recovered == after);
+        }
+
+        Save next = recovered;
+        for (u32 i = 0; i < save_size; ++i) {
+            if (next_change[i] not_eq before[i]) {
+                next[i] = next_change[i];
+            }
+        }
+
+        CHECK(store.write(next.data(), next.size()));
+        CHECK(read_back(*flash) == next);
+        CHECK(flash->stray_writes_ == 0);
+    }
+
+    printf("power cuts: %u operations, recovered the old save %d times, the "
+           "new save %d times\n",
+           operations,
+           recovered_before,
+           recovered_after);
+
+    CHECK(recovered_before > 0 and recovered_after > 0);
+}
+
+
+static void test_interrupted_saves()
+{
+    auto flash = std::make_unique<SimulatedFlash>();
+    SaveStore<SimulatedFlashBus> store{SimulatedFlashBus{flash.get()}};
+    store.mount();
+
+    Save save(save_size);
+    for (auto& byte : save) {
+        byte = random(256);
+    }
+    CHECK(store.write(save.data(), save.size()));
+
+    bool tested_compaction = false;
+
+    for (int i = 0; i < 200 and not tested_compaction; ++i) {
+        // Only change the lower half of the blocks, so that the upper half
+        // stays live in the oldest sectors, and compaction has to copy them.
+        // Then pick a block for the follow-up save, that the interrupted save
+        // leaves alone.
+        const Save after = change_blocks(save, 6, save_blocks / 2);
+        Save next_change = save;
+        for (u32 block = 0; block < save_blocks; ++block) {
+            const u32 start = block * save_record_payload;
+            if (std::equal(save.begin() + start,
+                           save.begin() + std::min(start + save_record_payload,
+                                                   save_size),
+                           after.begin() + start)) {
+                next_change[start] = save[start] + 1;
+                break;
+            }
+        }
+
+        // Whether the save has to compact a sector, to make room.
+        auto copy = std::make_unique<SimulatedFlash>(*flash);
+        {
+            SaveStore<SimulatedFlashBus> s{SimulatedFlashBus{copy.get()}};
+            s.mount();
+            s.write(after.data(), after.size());
+        }
+        const bool compacts = copy->sectors_erased_ > flash->sectors_erased_;
+
+        if (i == 0 or compacts) {
+            test_power_cuts(*flash, save, after, next_change);
+            tested_compaction = compacts;
+        }
+
+        CHECK(store.write(after.data(), after.size()));
+        save = after;
+    }
+
+    CHECK(tested_compaction);
+}
+
+
+// Enough saves to wrap around the chip several times.
+static void test_wrap_around()
+{
+    SimulatedFlash flash;
+    auto store =
+        std::make_unique<SaveStore<SimulatedFlashBus>>(SimulatedFlashBus{&flash});
+    store->mount();
+
+    Save save(save_size, 0);
+
+    for (int i = 0; i < 3000; ++i) {
+        save = change_blocks(save, 1 + random(8));
+        CHECK(store->write(save.data(), save.size()));
+
+        Save result(save_size);
+        store->read(result.data(), save_size);
+        CHECK(result == save);
+
+        // Reboot now and then, so that the store has to find the head and
+        // the tail of the log from scratch, wherever they are.
+        if (i % 97 == 0) {
+            store = std::make_unique<SaveStore<SimulatedFlashBus>>(
+                SimulatedFlashBus{&flash});
+            store->mount();
+            CHECK(store->write(save.data(), save.size()));
+        }
+    }
+
+    CHECK(read_back(flash) == save);
+
+    CHECK(flash.sectors_erased_ > 4 * save_sector_count);
+
+    // Wear leveling: every sector gets erased about as often as the others.
+    const auto wear = std::minmax_element(
+        std::begin(flash.sector_erases_), std::end(flash.sector_erases_));
+    CHECK(*wear.second - *wear.first <= 1);
+
+    CHECK(flash.stray_writes_ == 0);
+}
+
+
+int main(int, char**)
+{
+    test_round_trip();
+    test_interrupted_saves();
+    test_wrap_around();
+
+    return test_result("save_store_test");
+}
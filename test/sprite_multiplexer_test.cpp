@@ -0,0 +1,238 @@
+#include "graphics/spriteMultiplexer.hpp"
+#include "test.hpp"
+
+
+// Checks the schedule that the multiplexer produced, by replaying it the way
+// the hblank handler would: each slot starts the frame with its initial
+// object, and each rewrite hands the slot to a new object. Every object that
+// the multiplexer displays must own its slot for every line that it covers.
+// Returns the number of objects displayed.
+static int verify_schedule(const SpriteMultiplexer& mx)
+{
+    using Mx = SpriteMultiplexer;
+
+    const int lead = Mx::rewrite_lead;
+
+    // The first line at which each slot's current occupant is done drawing.
+    int free_line[Mx::hardware_slots];
+
+    bool shown[Mx::capacity] = {};
+    int shown_count = 0;
+
+    auto show = [&](Mx::ObjectIndex obj) {
+        CHECK(obj < mx.size());
+        CHECK(not shown[obj]);
+        shown[obj] = true;
+        ++shown_count;
+    };
+
+    for (int slot = 0; slot < Mx::hardware_slots; ++slot) {
+        free_line[slot] = 0;
+        const auto obj = mx.initial(slot);
+        if (obj not_eq Mx::null_object) {
+            show(obj);
+            const auto& o = mx.get(obj);
+            free_line[slot] = o.top_ + o.height_;
+        }
+    }
+
+    int line_load[Mx::screen_lines] = {};
+    int prev_line = 0;
+
+    for (int i = 0; i < mx.rewrite_count(); ++i) {
+        const auto& rw = mx.rewrite(i);
+
+        // Sorted by line, for the hblank handler.
+        CHECK(rw.line_ >= prev_line);
+        prev_line = rw.line_;
+
+        CHECK(rw.line_ < Mx::screen_lines);
+        ++line_load[rw.line_];
+
+        show(rw.object_);
+
+        const auto& o = mx.get(rw.object_);
+
+        // The new attributes take effect lead lines after the rewrite. By
+        // then, the previous occupant must have finished drawing, and the new
+        // object must not have started yet.
+        CHECK(rw.line_ + lead >= free_line[rw.slot_]);
+        CHECK(rw.line_ + lead <= o.top_);
+
+        free_line[rw.slot_] = o.top_ + o.height_;
+    }
+
+    // The hblank handler may only spend so long with OAM unlocked (the
+    // OBJ_HBLANK_FREE bit), so the multiplexer caps the rewrites per line.
+    for (int load : line_load) {
+        CHECK(load <= Mx::max_rewrites_per_line);
+    }
+
+    return shown_count;
+}
+
+
+static void push_sprite(SpriteMultiplexer& mx, int top, int height = 16)
+{
+    SpriteMultiplexer::Object obj;
+    obj.attr0_ = top & 0xff;
+    obj.attr1_ = 0;
+    obj.attr2_ = 0;
+    obj.top_ = top;
+    obj.height_ = height;
+    CHECK(mx.push(obj));
+}
+
+
+// Rows of sprites, spaced out vertically, twice as many as the hardware has
+// slots. Each row finishes drawing before the row after next starts, so the
+// multiplexer can hand every slot over to a sprite further down the screen.
+static void test_separated_rows()
+{
+    static SpriteMultiplexer mx;
+    mx.clear();
+
+    const int rows = 8;
+    const int per_row = SpriteMultiplexer::capacity / rows;
+
+    for (int row = 0; row < rows; ++row) {
+        for (int i = 0; i < per_row; ++i) {
+            push_sprite(mx, row * 20);
+        }
+    }
+
+    CHECK(mx.size() == SpriteMultiplexer::capacity);
+
+    CHECK(mx.schedule() == 0);
+    CHECK(mx.dropped() == 0);
+    CHECK(verify_schedule(mx) == mx.size());
+}
+
+
+// 128 sprites at the top of the screen fill every slot, then 100 more follow
+// in two rows further down. Each slot frees up at line 16, and the rewrites for
+// the row at line 60 may use any line from 14 to 58.
+static void test_full_first_row()
+{
+    static SpriteMultiplexer mx;
+    mx.clear();
+
+    for (int i = 0; i < 128; ++i) {
+        push_sprite(mx, 0);
+    }
+    for (int i = 0; i < 50; ++i) {
+        push_sprite(mx, 60);
+    }
+    for (int i = 0; i < 50; ++i) {
+        push_sprite(mx, 120);
+    }
+
+    CHECK(mx.schedule() == 0);
+    CHECK(verify_schedule(mx) == mx.size());
+}
+
+
+// Sprites below the screen never take a slot, and don't count as dropped.
+static void test_offscreen()
+{
+    static SpriteMultiplexer mx;
+    mx.clear();
+
+    for (int i = 0; i < 100; ++i) {
+        push_sprite(mx, 0);
+    }
+    for (int i = 0; i < 100; ++i) {
+        push_sprite(mx, SpriteMultiplexer::screen_lines + 10);
+    }
+
+    CHECK(mx.schedule() == 0);
+    CHECK(verify_schedule(mx) == 100);
+}
+
+
+// A band with more overlapping sprites than hardware slots. Each frame drops
+// the excess, and flicker rotation makes sure that the sprites dropped in one
+// frame show up in the next.
+static void test_flicker_rotation()
+{
+    static SpriteMultiplexer mx;
+
+    const int count = 200;
+
+    bool dropped_last_frame[count] = {};
+
+    for (int frame = 0; frame < 4; ++frame) {
+        mx.clear();
+        for (int i = 0; i < count; ++i) {
+            push_sprite(mx, 40);
+        }
+
+        const int dropped = mx.schedule();
+        const int shown = verify_schedule(mx);
+
+        CHECK(shown == SpriteMultiplexer::hardware_slots);
+        CHECK(dropped == count - shown);
+
+        bool shown_now[count] = {};
+        for (int slot = 0; slot < SpriteMultiplexer::hardware_slots; ++slot) {
+            const auto obj = mx.initial(slot);
+            if (obj not_eq SpriteMultiplexer::null_object) {
+                shown_now[obj] = true;
+            }
+        }
+        for (int i = 0; i < mx.rewrite_count(); ++i) {
+            shown_now[mx.rewrite(i).object_] = true;
+        }
+
+        if (frame > 0) {
+            for (int i = 0; i < count; ++i) {
+                if (dropped_last_frame[i]) {
+                    CHECK(shown_now[i]);
+                }
+            }
+        }
+
+        for (int i = 0; i < count; ++i) {
+            dropped_last_frame[i] = not shown_now[i];
+        }
+    }
+}
+
+
+// Many sprites that all start on the same line, right below a full set of
+// slots. The slots free up only a few lines earlier, so the rewrite budget,
+// rather than the number of slots, limits how many sprites we can show.
+static void test_rewrite_budget()
+{
+    static SpriteMultiplexer mx;
+    mx.clear();
+
+    for (int i = 0; i < 128; ++i) {
+        push_sprite(mx, 0, 8);
+    }
+    for (int i = 0; i < 128; ++i) {
+        push_sprite(mx, 10, 8);
+    }
+
+    const int dropped = mx.schedule();
+    const int shown = verify_schedule(mx);
+
+    // Slots free up at line 8, so the rewrites for sprites at line 10 have
+    // to happen on lines 6 through 8.
+    const int budget = 3 * SpriteMultiplexer::max_rewrites_per_line;
+
+    CHECK(shown == 128 + budget);
+    CHECK(dropped == 128 - budget);
+}
+
+
+int main()
+{
+    test_separated_rows();
+    test_full_first_row();
+    test_offscreen();
+    test_flicker_rotation();
+    test_rewrite_budget();
+
+    return test_result("sprite_multiplexer_test");
+}
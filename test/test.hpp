@@ -0,0 +1,35 @@
+#pragma once
+
+
+#include <cstdio>
+#include <cstdlib>
+
+
+// A minimal check macro for the host tests. We don't pull in a test framework,
+// the tests are small enough to be plain programs: each test prints what went
+// wrong, and exits with a non-zero status if any check failed.
+inline int test_failures = 0;
+
+
+#define CHECK(COND)                                                            \
+    do {                                                                       \
+        if (not(COND)) {                                                       \
+            std::fprintf(stderr,                                               \
+                         "%s:%d: check failed: %s\n",                          \
+                         __FILE__,                                             \
+                         __LINE__,                                             \
+                         #COND);                                               \
+            ++test_failures;                                                   \
+        }                                                                      \
+    } while (0)
+
+
+inline int test_result(const char* name)
+{
+    if (test_failures) {
+        std::fprintf(stderr, "%s: %d check(s) failed\n", name, test_failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("%s: ok\n", name);
+    return EXIT_SUCCESS;
+}
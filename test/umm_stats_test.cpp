@@ -0,0 +1,135 @@
+#include "test.hpp"
+#include <cstdint>
+#include <vector>
+
+extern "C" {
+#include "umm_malloc/src/umm_malloc.h"
+#include "umm_malloc/src/umm_malloc_cfg.h"
+}
+
+
+// meminfo() and memlog() read the heap through umm_free_stats(), which walks
+// only the free list, instead of umm_info(), which walks every block in the
+// heap. Both should see the same free memory. This test puts a heap of the
+// same size as the gba's through a few allocation patterns, and compares the
+// two after each one.
+
+
+alignas(4) static uint8_t heap[232000];
+
+void* UMM_MALLOC_CFG_HEAP_ADDR = &heap;
+uint32_t UMM_MALLOC_CFG_HEAP_SIZE = sizeof heap;
+
+
+static void compare(const char* when)
+{
+    UMM_FREE_STATS stats;
+    umm_free_stats(&stats);
+
+    umm_info(nullptr, false);
+    const auto& info = ummHeapInfo;
+
+    const int failures = test_failures;
+
+    CHECK(stats.freeEntries == info.freeEntries);
+    CHECK(stats.freeBlocks == info.freeBlocks);
+    CHECK(stats.freeBlocksSquared == info.freeBlocksSquared);
+    CHECK(stats.maxFreeBlocks == info.maxFreeContiguousBlocks);
+
+    CHECK(stats.freeBytes == umm_free_heap_size());
+    CHECK(stats.maxFreeBytes == umm_max_free_block_size());
+    CHECK(stats.heapBytes == sizeof heap);
+    CHECK(stats.freeBytes < stats.heapBytes);
+
+    if (test_failures not_eq failures) {
+        fprintf(stderr,
+                "%s: free list %u entries, %u blocks, largest %u; "
+                "umm_info %u entries, %u blocks, largest %u\n",
+                when,
+                stats.freeEntries,
+                stats.freeBlocks,
+                stats.maxFreeBlocks,
+                info.freeEntries,
+                info.freeBlocks,
+                info.maxFreeContiguousBlocks);
+    }
+}
+
+
+// Pseudo-random, so that the test does the same thing everywhere.
+static uint32_t seed = 1;
+static uint32_t random(uint32_t n)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % n;
+}
+
+
+int main(int, char**)
+{
+    umm_init();
+    compare("empty heap");
+
+    // Nothing but free memory, in one block.
+    UMM_FREE_STATS stats;
+    umm_free_stats(&stats);
+    CHECK(stats.freeEntries == 1);
+    CHECK(stats.maxFreeBlocks == stats.freeBlocks);
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 1000; ++i) {
+        blocks.push_back(umm_malloc(16 + i % 50));
+        CHECK(blocks.back() not_eq nullptr);
+    }
+    compare("after 1000 allocations");
+
+    // Leaves holes between the remaining allocations.
+    for (size_t i = 0; i < blocks.size(); i += 3) {
+        umm_free(blocks[i]);
+        blocks[i] = nullptr;
+    }
+    compare("after freeing every third allocation");
+
+    umm_free_stats(&stats);
+    CHECK(stats.freeEntries > 300);
+
+    // Lua's allocation pattern: lots of small objects, some resized, freed in
+    // no particular order.
+    for (int round = 0; round < 20000; ++round) {
+        auto& block = blocks[random(blocks.size())];
+        switch (random(3)) {
+        case 0:
+            umm_free(block);
+            block = umm_malloc(1 + random(200));
+            break;
+
+        case 1:
+            // Keeps the old block when the heap is too full to grow it.
+            if (auto grown = umm_realloc(block, 1 + random(400))) {
+                block = grown;
+            }
+            break;
+
+        case 2:
+            umm_free(block);
+            block = nullptr;
+            break;
+        }
+
+        if (round % 1000 == 0) {
+            compare("while churning");
+        }
+    }
+    compare("after churning");
+
+    // Everything coalesces back into one block.
+    for (auto block : blocks) {
+        umm_free(block);
+    }
+    compare("after freeing everything");
+
+    umm_free_stats(&stats);
+    CHECK(stats.freeEntries == 1);
+
+    return test_result("umm_stats_test");
+}